@@ -26,6 +26,9 @@
 #define LPS22HB_WHO_AM_I_REG        0x0f
 #define LPS22HB_CTRL1_REG           0x10
 #define LPS22HB_CTRL2_REG           0x11
+#define LPS22HB_CTRL3_REG           0x12
+#define LPS22HB_FIFO_CTRL_REG       0x14
+#define LPS22HB_FIFO_STATUS_REG     0x26
 #define LPS22HB_STATUS_REG          0x27
 #define LPS22HB_PRESS_OUT_XL_REG    0x28
 #define LPS22HB_PRESS_OUT_L_REG     0x29
@@ -33,10 +36,32 @@
 #define LPS22HB_TEMP_OUT_L_REG      0x2b
 #define LPS22HB_TEMP_OUT_H_REG      0x2c
 
+#define LPS22HB_CTRL2_ONE_SHOT      0x01
+#define LPS22HB_CTRL2_IF_ADD_INC    0x10
+#define LPS22HB_CTRL2_FIFO_EN       0x40
+#define LPS22HB_CTRL3_DRDY          0x04
+#define LPS22HB_STATUS_P_DA         0x01
+#define LPS22HB_FIFO_STATUS_FSS     0x3f
+
+#define PRESSURE_SEALEVEL_HPA  (1013.25f) /**< Average sea level pressure is 1013.25 hPa */
+
+#define LPS22HB_FIFO_DEPTH          32
+#define LPS22HB_SAMPLE_LEN          5
+
+// largest FIFO burst that fits in the Wire receive buffer
+#if defined(BUFFER_LENGTH)
+#define LPS22HB_MAX_BURST_SAMPLES   (BUFFER_LENGTH / LPS22HB_SAMPLE_LEN)
+#else
+#define LPS22HB_MAX_BURST_SAMPLES   LPS22HB_FIFO_DEPTH
+#endif
+
 LPS22HBClass::LPS22HBClass(TwoWire& wire) :
   _wire(&wire),
   _initialized(false),
-  _rate(RATE_ONE_SHOT)
+  _rate(RATE_ONE_SHOT),
+  _ctrl2(LPS22HB_CTRL2_IF_ADD_INC),
+  _lastPressure(0),
+  _seaLevelInv(1.0f / PRESSURE_SEALEVEL_HPA)
 {
 }
 
@@ -71,48 +96,263 @@ float LPS22HBClass::readPressure(int units)
 {
   if (_initialized == true) {
     if (_rate == RATE_ONE_SHOT) {
-      // trigger one shot
-      i2cWrite(LPS22HB_CTRL2_REG, 0x01);
+      oneShot();
+    }
 
-      // wait for ONE_SHOT bit to be cleared by the hardware
-      while ((i2cRead(LPS22HB_CTRL2_REG) & 0x01) != 0) {
-        yield();
-      }
+    uint8_t data[3];
+    if (!i2cReadBurst(LPS22HB_PRESS_OUT_XL_REG, data, sizeof(data))) {
+      return 0;
     }
 
-    float reading = (i2cRead(LPS22HB_PRESS_OUT_XL_REG) |
-            (i2cRead(LPS22HB_PRESS_OUT_L_REG) << 8) |
-            (i2cRead(LPS22HB_PRESS_OUT_H_REG) << 16)) / 40960.0;
+    return convertPressure(data, units);
+  }
+  return 0;
+}
+
+float LPS22HBClass::readTemperature(void)
+{
+  uint8_t data[2];
+  if (!i2cReadBurst(LPS22HB_TEMP_OUT_L_REG, data, sizeof(data))) {
+    return 0;
+  }
+
+  return convertTemperature(data);
+}
 
-    if (units == MILLIBAR) { // 1 kPa = 10 millibar
-      return reading * 10;
-    } else if (units == PSI) {  // 1 kPa = 0.145038 PSI
-      return reading * 0.145038;
-    } else {
-      return reading;
+int LPS22HBClass::readPressureAndTemperature(float& pressure, float& temperature, int units)
+{
+  if (_initialized == true) {
+    if (_rate == RATE_ONE_SHOT) {
+      oneShot();
     }
+
+    return readResult(pressure, temperature, units);
   }
   return 0;
 }
 
-float LPS22HBClass::readTemperature(void)
+int LPS22HBClass::startConversion()
 {
-  float reading = (i2cRead(LPS22HB_TEMP_OUT_L_REG) << 0) | 
-          (i2cRead(LPS22HB_TEMP_OUT_H_REG) << 8);
+  if (_initialized == false) {
+    return 0;
+  }
+
+  if (_rate != RATE_ONE_SHOT) {
+    // continuous mode, the sensor converts on its own
+    return 1;
+  }
+
+  // trigger one shot, keeping register address auto-increment and FIFO settings
+  return i2cWrite(LPS22HB_CTRL2_REG, _ctrl2 | LPS22HB_CTRL2_ONE_SHOT);
+}
+
+int LPS22HBClass::conversionReady()
+{
+  if (_rate == RATE_ONE_SHOT) {
+    // ONE_SHOT bit is cleared by the hardware once the conversion is done
+    int ctrl2 = i2cRead(LPS22HB_CTRL2_REG);
+    return (ctrl2 >= 0) && ((ctrl2 & LPS22HB_CTRL2_ONE_SHOT) == 0);
+  }
+
+  int status = i2cRead(LPS22HB_STATUS_REG);
+  return (status >= 0) && ((status & LPS22HB_STATUS_P_DA) != 0);
+}
+
+int LPS22HBClass::readResult(float& pressure, float& temperature, int units)
+{
+  if (_initialized == false) {
+    return 0;
+  }
+
+  // PRESS_OUT_XL..TEMP_OUT_H are contiguous, fetch them in one transaction
+  uint8_t data[5];
+  if (!i2cReadBurst(LPS22HB_PRESS_OUT_XL_REG, data, sizeof(data))) {
+    return 0;
+  }
+
+  pressure = convertPressure(data, units);
+  temperature = convertTemperature(&data[3]);
+  return 1;
+}
+
+int LPS22HBClass::setDataReadyInterrupt(bool enable)
+{
+  return i2cWrite(LPS22HB_CTRL3_REG, enable ? LPS22HB_CTRL3_DRDY : 0x00);
+}
+
+int LPS22HBClass::setFifoMode(int mode, int watermark)
+{
+  _ctrl2 = LPS22HB_CTRL2_IF_ADD_INC;
+  if (mode != FIFO_MODE_BYPASS) {
+    _ctrl2 |= LPS22HB_CTRL2_FIFO_EN;
+  }
+
+  if (!i2cWrite(LPS22HB_CTRL2_REG, _ctrl2)) {
+    return 0;
+  }
+
+  return i2cWrite(LPS22HB_FIFO_CTRL_REG, ((mode & 0x07) << 5) | (watermark & 0x1f));
+}
+
+int LPS22HBClass::fifoAvailable()
+{
+  int status = i2cRead(LPS22HB_FIFO_STATUS_REG);
+  if (status < 0) {
+    return -1;
+  }
+
+  // FSS counts up to 32 unread samples
+  int count = status & LPS22HB_FIFO_STATUS_FSS;
+  return (count > LPS22HB_FIFO_DEPTH) ? LPS22HB_FIFO_DEPTH : count;
+}
+
+int LPS22HBClass::readFifo(LPS22HBSample* samples, int count, int units)
+{
+  if (_initialized == false) {
+    return 0;
+  }
+
+  int available = fifoAvailable();
+  if (available <= 0) {
+    return 0;
+  }
+  if (count > available) {
+    count = available;
+  }
+
+  // with auto-increment the address rolls over from TEMP_OUT_H back to PRESS_OUT_XL,
+  // so consecutive FIFO samples can be read in a single burst
+  uint8_t data[LPS22HB_MAX_BURST_SAMPLES * LPS22HB_SAMPLE_LEN];
+  int read = 0;
+  while (read < count) {
+    int burst = count - read;
+    if (burst > LPS22HB_MAX_BURST_SAMPLES) {
+      burst = LPS22HB_MAX_BURST_SAMPLES;
+    }
+
+    if (!i2cReadBurst(LPS22HB_PRESS_OUT_XL_REG, data, burst * LPS22HB_SAMPLE_LEN)) {
+      break;
+    }
+
+    for (int i = 0; i < burst; i++) {
+      uint8_t* sample = &data[i * LPS22HB_SAMPLE_LEN];
+      samples[read + i].pressure = convertPressure(sample, units);
+      samples[read + i].temperature = convertTemperature(&sample[3]);
+    }
+    read += burst;
+  }
+
+  return read;
+}
+
+void LPS22HBClass::oneShot()
+{
+  startConversion();
+
+  // wait for ONE_SHOT bit to be cleared by the hardware
+  while (!conversionReady()) {
+    yield();
+  }
+}
+
+float LPS22HBClass::convertPressure(const uint8_t* data, int units)
+{
+  float reading = (data[0] | (data[1] << 8) | ((uint32_t)data[2] << 16)) / 40960.0f;
+
+  // remember the latest sample in hPa for lastAltitude()
+  _lastPressure = reading * 10;
+
+  if (units == MILLIBAR) { // 1 kPa = 10 millibar
+    return reading * 10;
+  } else if (units == PSI) {  // 1 kPa = 0.145038 PSI
+    return reading * 0.145038f;
+  } else {
+    return reading;
+  }
+}
+
+float LPS22HBClass::convertTemperature(const uint8_t* data)
+{
+  float reading = (int16_t)(data[0] | (data[1] << 8));
 
   return reading/100;
 }
 
-#define PRESSURE_SEALEVEL_HPA  (1013.25f) /**< Average sea level pressure is 1013.25 hPa */
 float LPS22HBClass::readAltitude(void)
 {
-  float atmospheric = BARO.readPressure(MILLIBAR);
+  return computeAltitude(BARO.readPressure(MILLIBAR), MILLIBAR);
+}
+
+float LPS22HBClass::lastAltitude(void)
+{
+  if (_lastPressure <= 0) {
+    // no pressure sample read yet
+    return NAN;
+  }
+
+  return computeAltitude(_lastPressure, MILLIBAR);
+}
+
+void LPS22HBClass::setSeaLevelPressure(float pressure, int units)
+{
+  float hpa = pressure;
+  if (units == KILOPASCAL) {
+    hpa *= 10;
+  } else if (units == PSI) {
+    hpa /= 0.0145038f;
+  }
+
+  if (hpa > 0) {
+    _seaLevelInv = 1.0f / hpa;
+  }
+}
+
+/*
+ * x^(1/5.255) in single precision, as exp(ln(x)/5.255) with short series.
+ * Relative error is below 1.1e-7 for x in [0.2, 1.5], i.e. under 5 mm of altitude
+ * over the sensor's 260 to 1260 hPa range, without calling the double precision pow().
+ */
+static float barometricPow(float x)
+{
+  if (x <= 0) {
+    return 0;
+  }
+
+  // ln(x) = e*ln(2) + ln(m), with m in [sqrt(0.5), sqrt(2)) and ln(m) = 2*atanh((m-1)/(m+1))
+  int e;
+  float m = frexpf(x, &e);
+  if (m < 0.70710678f) {
+    m *= 2;
+    e--;
+  }
+  float s = (m - 1) / (m + 1);
+  float s2 = s*s;
+  float lnm = 2*s*(1 + s2*(1.0f/3 + s2*(1.0f/5 + s2*(1.0f/7 + s2*(1.0f/9)))));
+  float y = (e*0.69314718f + lnm) * (1.0f/5.255f);
+
+  if (fabsf(y) > 0.5f) {
+    // far outside the sensor range
+    return expf(y);
+  }
+
+  // exp(y) for |y| <= 0.5
+  return 1 + y*(1 + y*(1.0f/2 + y*(1.0f/6 + y*(1.0f/24 + y*(1.0f/120 + y*(1.0f/720 + y*(1.0f/5040)))))));
+}
+
+float LPS22HBClass::computeAltitude(float pressure, int units)
+{
+  float atmospheric = pressure;
+  if (units == KILOPASCAL) {
+    atmospheric *= 10;
+  } else if (units == PSI) {
+    atmospheric /= 0.0145038f;
+  }
   /*
    * The altitude in meters can be calculated
    * with the international barometric formula
    */
-  return 44330.0 *
-    (1.0 - pow(atmospheric/PRESSURE_SEALEVEL_HPA, (1.0/5.255)));
+  return 44330.0f *
+    (1.0f - barometricPow(atmospheric*_seaLevelInv));
 }
 
 int LPS22HBClass::i2cRead(uint8_t reg)
@@ -130,6 +370,25 @@ int LPS22HBClass::i2cRead(uint8_t reg)
   return _wire->read();
 }
 
+int LPS22HBClass::i2cReadBurst(uint8_t reg, uint8_t* data, size_t length)
+{
+  _wire->beginTransmission(LPS22HB_ADDRESS);
+  _wire->write(reg);
+  if (_wire->endTransmission(false) != 0) {
+    return 0;
+  }
+
+  if (_wire->requestFrom((uint8_t)LPS22HB_ADDRESS, (uint8_t)length) != length) {
+    return 0;
+  }
+
+  for (size_t i = 0; i < length; i++) {
+    data[i] = _wire->read();
+  }
+
+  return 1;
+}
+
 int LPS22HBClass::i2cWrite(uint8_t reg, uint8_t val)
 {
   _wire->beginTransmission(LPS22HB_ADDRESS);
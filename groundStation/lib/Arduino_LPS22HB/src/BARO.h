@@ -38,6 +38,21 @@ enum {
   RATE_75_HZ = 5,
 };
 
+enum {
+  FIFO_MODE_BYPASS = 0,
+  FIFO_MODE_FIFO = 1,
+  FIFO_MODE_STREAM = 2,
+  FIFO_MODE_STREAM_TO_FIFO = 3,
+  FIFO_MODE_BYPASS_TO_STREAM = 4,
+  FIFO_MODE_DYNAMIC_STREAM = 6,
+  FIFO_MODE_BYPASS_TO_FIFO = 7,
+};
+
+struct LPS22HBSample {
+  float pressure;
+  float temperature;
+};
+
 class LPS22HBClass {
 public:
   LPS22HBClass(TwoWire& wire);
@@ -50,14 +65,37 @@ public:
   float readPressure(int units = KILOPASCAL);
   float readTemperature(void);
   float readAltitude(void);
+  float computeAltitude(float pressure, int units = KILOPASCAL);
+  float lastAltitude(void);
+  void setSeaLevelPressure(float pressure, int units = KILOPASCAL);
+  int readPressureAndTemperature(float& pressure, float& temperature, int units = KILOPASCAL);
+
+  // non-blocking conversion
+  int startConversion();
+  int conversionReady();
+  int readResult(float& pressure, float& temperature, int units = KILOPASCAL);
+  int setDataReadyInterrupt(bool enable);
+
+  // hardware FIFO
+  int setFifoMode(int mode, int watermark = 0);
+  int fifoAvailable();
+  int readFifo(LPS22HBSample* samples, int count, int units = KILOPASCAL);
 private:
+  void oneShot();
+  float convertPressure(const uint8_t* data, int units);
+  float convertTemperature(const uint8_t* data);
+
   int i2cRead(uint8_t reg);
+  int i2cReadBurst(uint8_t reg, uint8_t* data, size_t length);
   int i2cWrite(uint8_t reg, uint8_t val);
 
 private:
   TwoWire* _wire;
   bool _initialized;
   int _rate;
+  uint8_t _ctrl2;
+  float _lastPressure;
+  float _seaLevelInv;
 };
 
 extern LPS22HBClass BARO;
@@ -0,0 +1,89 @@
+// this is a benchmark of the AES-128 backends in RadioLibAES128
+// runs on any host, AES-NI is only tested on x86 CPUs that support it
+
+#include <RadioLib.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+
+#define BENCHMARK_BLOCKS  (200000)
+#define BENCHMARK_KEYS    (20000)
+#define BENCHMARK_MIC_LEN (64)
+
+static const char* backendNames[] = { "compact", "T-table", "AES-NI" };
+
+// returns the time per call in ns
+template<typename T>
+static double measure(size_t num, T func) {
+  auto start = std::chrono::steady_clock::now();
+  for(size_t i = 0; i < num; i++) {
+    func(i);
+  }
+  auto end = std::chrono::steady_clock::now();
+  return(std::chrono::duration<double, std::nano>(end - start).count() / (double)num);
+}
+
+// the entry point for the program
+int main(int argc, char** argv) {
+  (void)argc;
+  (void)argv;
+
+  uint8_t key[RADIOLIB_AES128_KEY_SIZE] = { 0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6, 0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c };
+  uint8_t msg[BENCHMARK_MIC_LEN] = { 0 };
+  uint8_t block[RADIOLIB_AES128_BLOCK_SIZE] = { 0 };
+  uint8_t reference[RADIOLIB_AES128_BLOCK_SIZE] = { 0 };
+  uint8_t out[RADIOLIB_AES128_BLOCK_SIZE] = { 0 };
+  volatile uint8_t sink = 0;
+
+  // the compact backend is the reference the others are checked against
+  RadioLibAES128 aes;
+  aes.setBackend(RADIOLIB_AES128_BACKEND_COMPACT);
+  aes.init(key);
+  aes.generateCMAC(msg, sizeof(msg), reference);
+
+  printf("%-10s %12s %12s %12s\n", "backend", "block [ns]", "CMAC64 [ns]", "new key [ns]");
+  for(uint8_t backend = RADIOLIB_AES128_BACKEND_COMPACT; backend <= RADIOLIB_AES128_BACKEND_AESNI; backend++) {
+    if(aes.setBackend(backend) != RADIOLIB_ERR_NONE) {
+      printf("%-10s not available\n", backendNames[backend]);
+      continue;
+    }
+
+    aes.init(key);
+    aes.generateCMAC(msg, sizeof(msg), out);
+    if(memcmp(out, reference, sizeof(out)) != 0) {
+      printf("%-10s wrong result\n", backendNames[backend]);
+      return(1);
+    }
+
+    // single block with the cached key, this is what LoRaWAN payload encryption costs
+    double blockNs = measure(BENCHMARK_BLOCKS, [&](size_t i) {
+      block[0] = (uint8_t)i;
+      aes.encryptECB(block, RADIOLIB_AES128_BLOCK_SIZE, out);
+      sink ^= out[0];
+    });
+
+    uint8_t micMsg[BENCHMARK_MIC_LEN];
+    memcpy(micMsg, msg, sizeof(micMsg));
+    double micNs = measure(BENCHMARK_BLOCKS / 4, [&](size_t i) {
+      micMsg[0] = (uint8_t)i;
+      aes.generateCMAC(micMsg, sizeof(micMsg), out);
+      sink ^= out[0];
+    });
+
+    // a key that is not cached has to be expanded first
+    uint8_t newKey[RADIOLIB_AES128_KEY_SIZE];
+    memcpy(newKey, key, sizeof(newKey));
+    double keyNs = measure(BENCHMARK_KEYS, [&](size_t i) {
+      aes.clearKeys();
+      newKey[0] = (uint8_t)i;
+      aes.init(newKey);
+      aes.encryptECB(block, RADIOLIB_AES128_BLOCK_SIZE, out);
+      sink ^= out[0];
+    });
+
+    printf("%-10s %12.1f %12.1f %12.1f\n", backendNames[backend], blockNs, micNs, keyNs);
+  }
+
+  return(0);
+}
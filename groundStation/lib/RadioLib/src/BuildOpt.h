@@ -104,6 +104,71 @@
   #define RADIOLIB_STATIC_ARRAY_SIZE   (256)
 #endif
 
+/*
+ * Number of register addresses covered by the Module register shadow cache.
+ * Registers that a driver marks as cacheable (i.e. never changed by the device itself) are mirrored in RAM,
+ * so read-modify-write access skips the SPI read and writes of unchanged values are skipped entirely.
+ * The cache costs this many bytes plus two bits per register for each Module, set to 0 to disable it.
+ */
+#if !defined(RADIOLIB_SPI_REG_CACHE_SIZE)
+  #define RADIOLIB_SPI_REG_CACHE_SIZE   (128)
+#endif
+
+/*
+ * Maximum number of register writes Module can hold between SPIbeginBatch and SPIendBatch.
+ * Writes to consecutive addresses are sent as a single burst transfer when the batch is flushed,
+ * a full batch is flushed early. Set to 0 to disable batching, writes are then sent immediately.
+ */
+#if !defined(RADIOLIB_SPI_BATCH_SIZE)
+  #define RADIOLIB_SPI_BATCH_SIZE   (16)
+#endif
+
+/*
+ * Number of slots in RadioLibPacketQueue (one is always kept free, so it holds one packet less) and TransmitQueueClient,
+ * and the maximum payload length each queued packet can hold. Longer packets are truncated.
+ * The queue only uses memory when the application creates one.
+ */
+#if !defined(RADIOLIB_PACKET_QUEUE_SIZE)
+  #define RADIOLIB_PACKET_QUEUE_SIZE      (8)
+#endif
+
+// RadioLibPacketQueue indices are single bytes and TransmitQueueClient uses -1 for "no slot"
+#if (RADIOLIB_PACKET_QUEUE_SIZE < 2) || (RADIOLIB_PACKET_QUEUE_SIZE > 127)
+  #error "RADIOLIB_PACKET_QUEUE_SIZE must be between 2 and 127"
+#endif
+
+#if !defined(RADIOLIB_PACKET_QUEUE_MAX_LEN)
+  #define RADIOLIB_PACKET_QUEUE_MAX_LEN   (255)
+#endif
+
+/*
+ * Number of buckets the RadioLibAirtimeBudget window is split into, and the number of channels it can track.
+ * Airtime is accounted per bucket, so a larger number follows the sliding window more closely.
+ * Each budget takes (buckets + 1) * (channels + 1) * 4 bytes.
+ */
+#if !defined(RADIOLIB_AIRTIME_BUDGET_BUCKETS)
+  #define RADIOLIB_AIRTIME_BUDGET_BUCKETS   (32)
+#endif
+
+#if !defined(RADIOLIB_AIRTIME_BUDGET_CHANNELS)
+  #define RADIOLIB_AIRTIME_BUDGET_CHANNELS  (4)
+#endif
+
+/*
+ * AES-128 encryption backend used by RadioLibAES128, decryption always uses the compact one.
+ * RADIOLIB_AES128_BACKEND_COMPACT - byte-oriented, smallest code
+ * RADIOLIB_AES128_BACKEND_TTABLE - 32-bit lookup table, several times faster for 1 kB of extra flash
+ * RADIOLIB_AES128_BACKEND_AESNI - x86 AES instructions, needs -maes, otherwise the T-table backend is used
+ * Every backend up to the selected one is compiled in and can be switched to with RadioLibAES128::setBackend.
+ */
+#define RADIOLIB_AES128_BACKEND_COMPACT     (0)
+#define RADIOLIB_AES128_BACKEND_TTABLE      (1)
+#define RADIOLIB_AES128_BACKEND_AESNI       (2)
+
+#if !defined(RADIOLIB_AES128_BACKEND)
+  #define RADIOLIB_AES128_BACKEND           (RADIOLIB_AES128_BACKEND_COMPACT)
+#endif
+
 /*
  * Uncomment on boards whose clock runs too slow or too fast
  * Set the value according to the following scheme:
@@ -451,6 +516,50 @@
   #define RADIOLIB_EXCLUDE_STM32WLX (1)
 #endif
 
+/*
+ * Size of the two stack buffers used by Module to clock SPI transfers, so no dynamic allocation
+ * is needed for SPI access regardless of RADIOLIB_STATIC_ONLY. Where RAM allows, the default fits the longest frame
+ * any module uses (up to 8 bytes of command, address and status plus a 255-byte FIFO access),
+ * so every transfer is a single call to RadioLibHal::spiTransfer.
+ * Low-end platforms default to 32 bytes to keep the buffers off their small stack, longer transfers are then
+ * split into several spiTransfer calls within one chip select window. That only works with a HAL that leaves
+ * chip select to Module (e.g. ArduinoHal, not Linux spidev with hardware CE).
+ */
+#if !defined(RADIOLIB_SPI_CHUNK_SIZE)
+  #if defined(RADIOLIB_LOWEND_PLATFORM)
+    #define RADIOLIB_SPI_CHUNK_SIZE (32)
+  #else
+    #define RADIOLIB_SPI_CHUNK_SIZE (8 + 255)
+  #endif
+#endif
+
+/*
+ * Number of expanded AES-128 key schedules (and CMAC subkeys) kept by RadioLibAES128, at least 1.
+ * Switching to a cached key costs a 16-byte comparison instead of a key expansion.
+ * Four covers all LoRaWAN session keys, each entry takes 229 bytes.
+ * Low-end platforms default to a single entry, every key switch then expands the key again.
+ */
+#if !defined(RADIOLIB_AES128_KEY_CACHE_SIZE)
+  #if defined(RADIOLIB_LOWEND_PLATFORM)
+    #define RADIOLIB_AES128_KEY_CACHE_SIZE (1)
+  #else
+    #define RADIOLIB_AES128_KEY_CACHE_SIZE (4)
+  #endif
+#endif
+
+/*
+ * Number of 256-entry lookup tables RadioLibCRC generates for the configured polynomial (1 kB of RAM each).
+ * 1 processes one byte per lookup, 4 or 8 (slice-by-4/8) process several bytes at once, 0 calculates bit by bit.
+ * Low-end platforms do not have the RAM to spare and default to 0.
+ */
+#if !defined(RADIOLIB_CRC_TABLE_SLICES)
+  #if defined(RADIOLIB_LOWEND_PLATFORM)
+    #define RADIOLIB_CRC_TABLE_SLICES (0)
+  #else
+    #define RADIOLIB_CRC_TABLE_SLICES (1)
+  #endif
+#endif
+
 // set the global debug mode flag
 #if RADIOLIB_DEBUG_BASIC || RADIOLIB_DEBUG_PROTOCOL || RADIOLIB_DEBUG_SPI
   #define RADIOLIB_DEBUG  (1)
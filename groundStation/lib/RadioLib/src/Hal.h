@@ -148,7 +148,8 @@ class RadioLibHal {
     virtual void spiBeginTransaction() = 0;
 
     /*!
-      \brief Method to transfer buffer over SPI.
+      \brief Method to transfer buffer over SPI. Chip select is driven by Module and must stay asserted
+      across calls: transfers longer than RADIOLIB_SPI_CHUNK_SIZE are made with several calls.
       \param out Buffer to send.
       \param len Number of data to send or receive.
       \param in Buffer to save received data into.
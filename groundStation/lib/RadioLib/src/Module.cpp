@@ -10,6 +10,41 @@
 #include <stdarg.h>
 #endif
 
+#if defined(ESP_PLATFORM)
+#include "esp_attr.h"
+#endif
+
+// attachInterrupt only takes plain functions, so each timestamped interrupt needs its own global-scope ISR
+// that looks up the module and the user function
+static Module* irqTimestampModules[RADIOLIB_MODULE_IRQ_TIMESTAMP_SLOTS] = { NULL };
+static void (*irqTimestampFuncs[RADIOLIB_MODULE_IRQ_TIMESTAMP_SLOTS])(void) = { NULL };
+
+static void irqTimestampHandler(uint8_t slot) {
+  Module* mod = irqTimestampModules[slot];
+  if(mod) {
+    mod->irqTimestamp = mod->hal->micros();
+  }
+  if(irqTimestampFuncs[slot]) {
+    irqTimestampFuncs[slot]();
+  }
+}
+
+#if defined(ESP8266) || defined(ESP32)
+  IRAM_ATTR
+#endif
+static void irqTimestampSlot0(void) {
+  irqTimestampHandler(0);
+}
+
+#if defined(ESP8266) || defined(ESP32)
+  IRAM_ATTR
+#endif
+static void irqTimestampSlot1(void) {
+  irqTimestampHandler(1);
+}
+
+static void (*const irqTimestampSlots[RADIOLIB_MODULE_IRQ_TIMESTAMP_SLOTS])(void) = { irqTimestampSlot0, irqTimestampSlot1 };
+
 #if defined(RADIOLIB_BUILD_ARDUINO)
 #include "ArduinoHal.h"
 
@@ -52,12 +87,49 @@ void Module::term() {
   this->hal->term();
 }
 
+void Module::attachTimestampedInterrupt(uint32_t pin, void (*func)(void), uint32_t mode) {
+  // reuse the slot of this module, or take a free one
+  int8_t slot = -1;
+  for(uint8_t i = 0; i < RADIOLIB_MODULE_IRQ_TIMESTAMP_SLOTS; i++) {
+    if(irqTimestampModules[i] == this) {
+      slot = i;
+      break;
+    }
+    if((slot < 0) && (irqTimestampModules[i] == NULL)) {
+      slot = i;
+    }
+  }
+
+  if(slot < 0) {
+    RADIOLIB_DEBUG_BASIC_PRINTLN("No free interrupt timestamp slot, attaching without timestamp");
+    this->hal->attachInterrupt(pin, func, mode);
+    return;
+  }
+
+  irqTimestampFuncs[slot] = func;
+  irqTimestampModules[slot] = this;
+  this->hal->attachInterrupt(pin, irqTimestampSlots[slot], mode);
+}
+
+void Module::detachTimestampedInterrupt(uint32_t pin) {
+  this->hal->detachInterrupt(pin);
+  for(uint8_t i = 0; i < RADIOLIB_MODULE_IRQ_TIMESTAMP_SLOTS; i++) {
+    if(irqTimestampModules[i] == this) {
+      irqTimestampModules[i] = NULL;
+      irqTimestampFuncs[i] = NULL;
+    }
+  }
+}
+
 int16_t Module::SPIgetRegValue(uint32_t reg, uint8_t msb, uint8_t lsb) {
   if((msb > 7) || (lsb > 7) || (lsb > msb)) {
     return(RADIOLIB_ERR_INVALID_BIT_RANGE);
   }
 
-  uint8_t rawValue = SPIreadRegister(reg);
+  uint8_t rawValue = 0;
+  if(!this->getCachedReg(reg, &rawValue)) {
+    rawValue = SPIreadRegister(reg);
+  }
   uint8_t maskedValue = rawValue & ((0b11111111 << lsb) & (0b11111111 >> (7 - msb)));
   return(maskedValue);
 }
@@ -67,9 +139,29 @@ int16_t Module::SPIsetRegValue(uint32_t reg, uint8_t value, uint8_t msb, uint8_t
     return(RADIOLIB_ERR_INVALID_BIT_RANGE);
   }
 
-  uint8_t currentValue = SPIreadRegister(reg);
+  uint8_t currentValue = 0;
+  bool cached = this->getCachedReg(reg, &currentValue);
+  if(!cached) {
+    currentValue = SPIreadRegister(reg);
+  }
   uint8_t mask = ~((0b11111111 << (msb + 1)) | (0b11111111 >> (8 - lsb)));
   uint8_t newValue = (currentValue & ~mask) | (value & mask);
+
+  // the device never changes cached registers, so there is nothing to write or verify
+  if(cached && (newValue == currentValue)) {
+    return(RADIOLIB_ERR_NONE);
+  }
+
+  // within a batch, the write is verified when the batch is flushed
+  #if RADIOLIB_SPI_PARANOID
+  if(this->queueRegWrite(reg, newValue, checkMask)) {
+    return(RADIOLIB_ERR_NONE);
+  }
+  #else
+  if(this->queueRegWrite(reg, newValue, 0x00)) {
+    return(RADIOLIB_ERR_NONE);
+  }
+  #endif
   SPIwriteRegister(reg, newValue);
 
   #if RADIOLIB_SPI_PARANOID
@@ -102,6 +194,9 @@ int16_t Module::SPIsetRegValue(uint32_t reg, uint8_t value, uint8_t msb, uint8_t
 }
 
 void Module::SPIreadRegisterBurst(uint32_t reg, size_t numBytes, uint8_t* inBytes) {
+  // the read may depend on queued writes, so they go first
+  this->flushBatch();
+
   if(!this->spiConfig.stream) {
     SPItransfer(this->spiConfig.cmds[RADIOLIB_MODULE_SPI_COMMAND_READ], reg, NULL, inBytes, numBytes);
   } else {
@@ -115,9 +210,13 @@ void Module::SPIreadRegisterBurst(uint32_t reg, size_t numBytes, uint8_t* inByte
     }
     SPItransferStream(cmd, this->spiConfig.widths[RADIOLIB_MODULE_SPI_WIDTH_CMD]/8 + this->spiConfig.widths[RADIOLIB_MODULE_SPI_WIDTH_ADDR]/8, false, NULL, inBytes, numBytes, true, RADIOLIB_MODULE_SPI_TIMEOUT);
   }
+  this->updateRegCache(reg, inBytes, numBytes);
 }
 
 uint8_t Module::SPIreadRegister(uint32_t reg) {
+  // the read may depend on queued writes, so they go first
+  this->flushBatch();
+
   uint8_t resp = 0;
   if(!spiConfig.stream) {
     SPItransfer(this->spiConfig.cmds[RADIOLIB_MODULE_SPI_COMMAND_READ], reg, NULL, &resp, 1);
@@ -132,10 +231,14 @@ uint8_t Module::SPIreadRegister(uint32_t reg) {
     }
     SPItransferStream(cmd, this->spiConfig.widths[RADIOLIB_MODULE_SPI_WIDTH_CMD]/8 + this->spiConfig.widths[RADIOLIB_MODULE_SPI_WIDTH_ADDR]/8, false, NULL, &resp, 1, true, RADIOLIB_MODULE_SPI_TIMEOUT);
   }
+  this->updateRegCache(reg, &resp, 1);
   return(resp);
 }
 
 void Module::SPIwriteRegisterBurst(uint32_t reg, uint8_t* data, size_t numBytes) {
+  // keep the order of writes, queued ones go first
+  this->flushBatch();
+
   if(!spiConfig.stream) {
     SPItransfer(spiConfig.cmds[RADIOLIB_MODULE_SPI_COMMAND_WRITE], reg, data, NULL, numBytes);
   } else {
@@ -149,9 +252,14 @@ void Module::SPIwriteRegisterBurst(uint32_t reg, uint8_t* data, size_t numBytes)
     }
     SPItransferStream(cmd, this->spiConfig.widths[RADIOLIB_MODULE_SPI_WIDTH_CMD]/8 + this->spiConfig.widths[RADIOLIB_MODULE_SPI_WIDTH_ADDR]/8, true, data, NULL, numBytes, true, RADIOLIB_MODULE_SPI_TIMEOUT);
   }
+  this->updateRegCache(reg, data, numBytes);
 }
 
 void Module::SPIwriteRegister(uint32_t reg, uint8_t data) {
+  if(this->queueRegWrite(reg, data, 0x00)) {
+    return;
+  }
+
   if(!spiConfig.stream) {
     SPItransfer(spiConfig.cmds[RADIOLIB_MODULE_SPI_COMMAND_WRITE], reg, &data, NULL, 1);
   } else {
@@ -165,68 +273,273 @@ void Module::SPIwriteRegister(uint32_t reg, uint8_t data) {
     }
     SPItransferStream(cmd, this->spiConfig.widths[RADIOLIB_MODULE_SPI_WIDTH_CMD]/8 + this->spiConfig.widths[RADIOLIB_MODULE_SPI_WIDTH_ADDR]/8, true, &data, NULL, 1, true, RADIOLIB_MODULE_SPI_TIMEOUT);
   }
+  this->updateRegCache(reg, &data, 1);
 }
 
-void Module::SPItransfer(uint16_t cmd, uint32_t reg, uint8_t* dataOut, uint8_t* dataIn, size_t numBytes) {
-  // prepare the buffers
-  size_t buffLen = this->spiConfig.widths[RADIOLIB_MODULE_SPI_WIDTH_CMD]/8 + this->spiConfig.widths[RADIOLIB_MODULE_SPI_WIDTH_ADDR]/8 + numBytes;
-  #if RADIOLIB_STATIC_ONLY
-    uint8_t buffOut[RADIOLIB_STATIC_ARRAY_SIZE];
-    uint8_t buffIn[RADIOLIB_STATIC_ARRAY_SIZE];
+void Module::SPIsetRegCacheable(const uint16_t* regs, size_t numRegs) {
+  #if RADIOLIB_SPI_REG_CACHE_SIZE
+  for(size_t i = 0; i < numRegs; i++) {
+    if(regs[i] < RADIOLIB_SPI_REG_CACHE_SIZE) {
+      this->regCacheable[regs[i] / 8] |= (1 << (regs[i] % 8));
+    }
+  }
   #else
-    uint8_t* buffOut = new uint8_t[buffLen];
-    uint8_t* buffIn = new uint8_t[buffLen];
+  (void)regs;
+  (void)numRegs;
   #endif
-  uint8_t* buffOutPtr = buffOut;
+}
 
-  // copy the command
-  // TODO properly handle variable commands and addresses
-  if(this->spiConfig.widths[RADIOLIB_MODULE_SPI_WIDTH_ADDR] <= 8) {
-    *(buffOutPtr++) = reg | cmd;
-  } else {
-    *(buffOutPtr++) = (reg >> 8) | cmd;
-    *(buffOutPtr++) = reg & 0xFF;
+void Module::SPIinvalidateRegCache() {
+  #if RADIOLIB_SPI_REG_CACHE_SIZE
+  memset(this->regCacheValid, 0x00, sizeof(this->regCacheValid));
+  #endif
+}
+
+void Module::SPIclearRegCache() {
+  #if RADIOLIB_SPI_REG_CACHE_SIZE
+  memset(this->regCacheable, 0x00, sizeof(this->regCacheable));
+  memset(this->regCacheValid, 0x00, sizeof(this->regCacheValid));
+  #endif
+}
+
+bool Module::isRegCacheable(uint32_t reg) {
+  #if RADIOLIB_SPI_REG_CACHE_SIZE
+  return((reg < RADIOLIB_SPI_REG_CACHE_SIZE) && (this->regCacheable[reg / 8] & (1 << (reg % 8))));
+  #else
+  (void)reg;
+  return(false);
+  #endif
+}
+
+bool Module::getCachedReg(uint32_t reg, uint8_t* value) {
+  // the device may change any other register by itself, those are always read
+  if(!this->isRegCacheable(reg)) {
+    return(false);
+  }
+
+  #if RADIOLIB_SPI_BATCH_SIZE
+  // a write that is still queued holds the newest value
+  for(size_t i = this->batchLen; i > 0; i--) {
+    if(this->batch[i - 1].reg == reg) {
+      *value = this->batch[i - 1].value;
+      return(true);
+    }
   }
+  #endif
 
-  // copy the data
-  if(cmd == spiConfig.cmds[RADIOLIB_MODULE_SPI_COMMAND_WRITE]) {
-    memcpy(buffOutPtr, dataOut, numBytes);
+  #if RADIOLIB_SPI_REG_CACHE_SIZE
+  if(this->regCacheValid[reg / 8] & (1 << (reg % 8))) {
+    *value = this->regCache[reg];
+    return(true);
+  }
+  #else
+  (void)value;
+  #endif
+  return(false);
+}
+
+void Module::updateRegCache(uint32_t reg, uint8_t* data, size_t numBytes) {
+  #if RADIOLIB_SPI_REG_CACHE_SIZE
+  // burst access starting at a non-cacheable register (e.g. FIFO) does not auto-increment the address,
+  // so only bursts that start at a cacheable register are mirrored
+  if((data == NULL) || !this->isRegCacheable(reg)) {
+    return;
+  }
+
+  for(size_t i = 0; (i < numBytes) && (reg + i < RADIOLIB_SPI_REG_CACHE_SIZE); i++) {
+    uint32_t addr = reg + i;
+    if(this->isRegCacheable(addr)) {
+      this->regCache[addr] = data[i];
+      this->regCacheValid[addr / 8] |= (1 << (addr % 8));
+    }
+  }
+  #else
+  (void)reg;
+  (void)data;
+  (void)numBytes;
+  #endif
+}
+
+void Module::SPIbeginBatch() {
+  #if RADIOLIB_SPI_BATCH_SIZE
+  if(this->batchDepth == 0) {
+    this->batchState = RADIOLIB_ERR_NONE;
+  }
+  this->batchDepth++;
+  #endif
+}
+
+int16_t Module::SPIendBatch() {
+  #if RADIOLIB_SPI_BATCH_SIZE
+  if(this->batchDepth == 0) {
+    return(RADIOLIB_ERR_NONE);
+  }
+
+  this->batchDepth--;
+  if(this->batchDepth > 0) {
+    return(RADIOLIB_ERR_NONE);
+  }
+  this->flushBatch();
+  return(this->batchState);
+  #else
+  return(RADIOLIB_ERR_NONE);
+  #endif
+}
+
+bool Module::queueRegWrite(uint32_t reg, uint8_t value, uint8_t checkMask) {
+  #if RADIOLIB_SPI_BATCH_SIZE
+  if((this->batchDepth == 0) || this->spiConfig.stream) {
+    return(false);
+  }
+
+  if(this->batchLen >= RADIOLIB_SPI_BATCH_SIZE) {
+    this->flushBatch();
+  }
+  this->batch[this->batchLen].reg = reg;
+  this->batch[this->batchLen].value = value;
+  this->batch[this->batchLen].checkMask = checkMask;
+  this->batchLen++;
+  return(true);
+  #else
+  (void)reg;
+  (void)value;
+  (void)checkMask;
+  return(false);
+  #endif
+}
+
+void Module::flushBatch() {
+  #if RADIOLIB_SPI_BATCH_SIZE
+  // clear the queue first, the burst methods below must not flush again
+  size_t len = this->batchLen;
+  this->batchLen = 0;
+
+  size_t i = 0;
+  while(i < len) {
+    // find the run of consecutive addresses starting at this entry, same as for the cache,
+    // only a burst starting at a cacheable register is known to auto-increment (unlike e.g. FIFO)
+    uint8_t data[RADIOLIB_SPI_BATCH_SIZE];
+    uint8_t checkMask = this->batch[i].checkMask;
+    bool merge = this->isRegCacheable(this->batch[i].reg);
+    size_t run = 0;
+    do {
+      data[run] = this->batch[i + run].value;
+      checkMask |= this->batch[i + run].checkMask;
+      run++;
+    } while(merge && (i + run < len) && (this->batch[i + run].reg == this->batch[i].reg + run));
+
+    SPIwriteRegisterBurst(this->batch[i].reg, data, run);
+    for(size_t n = 0; n < run; n++) {
+      this->updateRegCache(this->batch[i + n].reg, &data[n], 1);
+    }
+
+    // verify the whole run with a single burst read
+    if(checkMask) {
+      uint8_t readBack[RADIOLIB_SPI_BATCH_SIZE];
+      SPIreadRegisterBurst(this->batch[i].reg, run, readBack);
+      for(size_t n = 0; n < run; n++) {
+        if((readBack[n] & this->batch[i + n].checkMask) != (data[n] & this->batch[i + n].checkMask)) {
+          RADIOLIB_DEBUG_SPI_PRINTLN("batch write failed at 0x%X: new 0x%X, read 0x%X", this->batch[i + n].reg, data[n], readBack[n]);
+          this->batchState = RADIOLIB_ERR_SPI_WRITE_FAILED;
+        }
+      }
+    }
+
+    i += run;
+  }
+  #endif
+}
+
+void Module::SPItransfer(uint16_t cmd, uint32_t reg, uint8_t* dataOut, uint8_t* dataIn, size_t numBytes) {
+  // prepare the command and address
+  // TODO properly handle variable commands and addresses
+  uint8_t header[2];
+  size_t headerLen = 0;
+  if(this->spiConfig.widths[RADIOLIB_MODULE_SPI_WIDTH_ADDR] <= 8) {
+    header[headerLen++] = reg | cmd;
   } else {
-    memset(buffOutPtr, this->spiConfig.cmds[RADIOLIB_MODULE_SPI_COMMAND_NOP], numBytes);
+    header[headerLen++] = (reg >> 8) | cmd;
+    header[headerLen++] = reg & 0xFF;
   }
 
   // do the transfer
+  bool write = (cmd == spiConfig.cmds[RADIOLIB_MODULE_SPI_COMMAND_WRITE]);
+  bool read = (cmd == spiConfig.cmds[RADIOLIB_MODULE_SPI_COMMAND_READ]);
   this->hal->spiBeginTransaction();
   this->hal->digitalWrite(this->csPin, this->hal->GpioLevelLow);
-  this->hal->spiTransfer(buffOut, buffLen, buffIn);
+  this->SPItransferFrame(header, headerLen, 0, write ? dataOut : NULL, read ? dataIn : NULL, numBytes, NULL);
   this->hal->digitalWrite(this->csPin, this->hal->GpioLevelHigh);
   this->hal->spiEndTransaction();
-  
-  // copy the data
-  if(cmd == spiConfig.cmds[RADIOLIB_MODULE_SPI_COMMAND_READ]) {
-    memcpy(dataIn, &buffIn[this->spiConfig.widths[RADIOLIB_MODULE_SPI_WIDTH_ADDR]/8], numBytes);
-  }
 
   // print debug information
   #if RADIOLIB_DEBUG_SPI
     uint8_t* debugBuffPtr = NULL;
-    if(cmd == spiConfig.cmds[RADIOLIB_MODULE_SPI_COMMAND_WRITE]) {
+    if(write) {
       RADIOLIB_DEBUG_SPI_PRINT("W\t%X\t", reg);
-      debugBuffPtr = &buffOut[this->spiConfig.widths[RADIOLIB_MODULE_SPI_WIDTH_ADDR]/8];
-    } else if(cmd == spiConfig.cmds[RADIOLIB_MODULE_SPI_COMMAND_READ]) {
+      debugBuffPtr = dataOut;
+    } else if(read) {
       RADIOLIB_DEBUG_SPI_PRINT("R\t%X\t", reg);
-      debugBuffPtr = &buffIn[this->spiConfig.widths[RADIOLIB_MODULE_SPI_WIDTH_ADDR]/8];
+      debugBuffPtr = dataIn;
     }
-    for(size_t n = 0; n < numBytes; n++) {
+    for(size_t n = 0; (debugBuffPtr != NULL) && (n < numBytes); n++) {
       RADIOLIB_DEBUG_SPI_PRINT_NOTAG("%X\t", debugBuffPtr[n]);
     }
     RADIOLIB_DEBUG_SPI_PRINTLN_NOTAG();
   #endif
+}
 
-  #if !RADIOLIB_STATIC_ONLY
-    delete[] buffOut;
-    delete[] buffIn;
-  #endif
+void Module::SPItransferFrame(uint8_t* header, size_t headerLen, size_t padLen, uint8_t* dataOut, uint8_t* dataIn, size_t numBytes, uint8_t* status) {
+  // the frame is sent through fixed-size scratch buffers on the stack, so the transfer never allocates,
+  // frames longer than the buffers (on low-end platforms or with a reduced RADIOLIB_SPI_CHUNK_SIZE) are sent in several calls
+  uint8_t buffOut[RADIOLIB_SPI_CHUNK_SIZE];
+  uint8_t buffIn[RADIOLIB_SPI_CHUNK_SIZE];
+  size_t dataStart = headerLen + padLen;
+  size_t frameLen = dataStart + numBytes;
+
+  for(size_t pos = 0; pos < frameLen; pos += RADIOLIB_SPI_CHUNK_SIZE) {
+    size_t chunkLen = frameLen - pos;
+    if(chunkLen > RADIOLIB_SPI_CHUNK_SIZE) {
+      chunkLen = RADIOLIB_SPI_CHUNK_SIZE;
+    }
+
+    // header first, then outgoing data or NOPs
+    for(size_t i = 0; i < chunkLen; i++) {
+      size_t n = pos + i;
+      if(n < headerLen) {
+        buffOut[i] = header[n];
+      } else if((n < dataStart) || (dataOut == NULL)) {
+        buffOut[i] = this->spiConfig.cmds[RADIOLIB_MODULE_SPI_COMMAND_NOP];
+      } else {
+        buffOut[i] = dataOut[n - dataStart];
+      }
+    }
+
+    this->hal->spiTransfer(buffOut, chunkLen, buffIn);
+
+    // pick out the status byte and incoming data
+    for(size_t i = 0; i < chunkLen; i++) {
+      size_t n = pos + i;
+      if((status != NULL) && (n == this->spiConfig.statusPos)) {
+        *status = buffIn[i];
+      }
+      if((dataIn != NULL) && (n >= dataStart)) {
+        dataIn[n - dataStart] = buffIn[i];
+      }
+    }
+
+    #if RADIOLIB_DEBUG_SPI
+      RADIOLIB_DEBUG_SPI_PRINT("SI\t");
+      for(size_t i = 0; i < chunkLen; i++) {
+        RADIOLIB_DEBUG_SPI_PRINT_NOTAG("%X\t", buffOut[i]);
+      }
+      RADIOLIB_DEBUG_SPI_PRINTLN_NOTAG();
+      RADIOLIB_DEBUG_SPI_PRINT("SO\t");
+      for(size_t i = 0; i < chunkLen; i++) {
+        RADIOLIB_DEBUG_SPI_PRINT_NOTAG("%X\t", buffIn[i]);
+      }
+      RADIOLIB_DEBUG_SPI_PRINTLN_NOTAG();
+    #endif
+  }
 }
 
 int16_t Module::SPIreadStream(uint16_t cmd, uint8_t* data, size_t numBytes, bool waitForGpio, bool verify) {
@@ -309,32 +622,6 @@ int16_t Module::SPIcheckStream() {
 }
 
 int16_t Module::SPItransferStream(uint8_t* cmd, uint8_t cmdLen, bool write, uint8_t* dataOut, uint8_t* dataIn, size_t numBytes, bool waitForGpio, uint32_t timeout) {
-  // prepare the buffers
-  size_t buffLen = cmdLen + numBytes;
-  if(!write) {
-    buffLen += (this->spiConfig.widths[RADIOLIB_MODULE_SPI_WIDTH_STATUS] / 8);
-  }
-  #if RADIOLIB_STATIC_ONLY
-    uint8_t buffOut[RADIOLIB_STATIC_ARRAY_SIZE];
-    uint8_t buffIn[RADIOLIB_STATIC_ARRAY_SIZE];
-  #else
-    uint8_t* buffOut = new uint8_t[buffLen];
-    uint8_t* buffIn = new uint8_t[buffLen];
-  #endif
-  uint8_t* buffOutPtr = buffOut;
-
-  // copy the command
-  for(uint8_t n = 0; n < cmdLen; n++) {
-    *(buffOutPtr++) = cmd[n];
-  }
-
-  // copy the data
-  if(write) {
-    memcpy(buffOutPtr, dataOut, numBytes);
-  } else {
-    memset(buffOutPtr, this->spiConfig.cmds[RADIOLIB_MODULE_SPI_COMMAND_NOP], numBytes + (this->spiConfig.widths[RADIOLIB_MODULE_SPI_WIDTH_STATUS] / 8));
-  }
-
   // ensure GPIO is low
   if(this->gpioPin == RADIOLIB_NC) {
     this->hal->delay(50);
@@ -344,19 +631,32 @@ int16_t Module::SPItransferStream(uint8_t* cmd, uint8_t cmdLen, bool write, uint
       this->hal->yield();
       if(this->hal->millis() - start >= timeout) {
         RADIOLIB_DEBUG_BASIC_PRINTLN("GPIO pre-transfer timeout, is it connected?");
-        #if !RADIOLIB_STATIC_ONLY
-          delete[] buffOut;
-          delete[] buffIn;
-        #endif
         return(RADIOLIB_ERR_SPI_CMD_TIMEOUT);
       }
     }
   }
 
-  // do the transfer
+  // print debug information
+  #if RADIOLIB_DEBUG_SPI
+    // print command byte(s)
+    RADIOLIB_DEBUG_SPI_PRINT("CMD");
+    if(write) {
+      RADIOLIB_DEBUG_SPI_PRINT_NOTAG("W\t");
+    } else {
+      RADIOLIB_DEBUG_SPI_PRINT_NOTAG("R\t");
+    }
+    for(size_t n = 0; n < cmdLen; n++) {
+      RADIOLIB_DEBUG_SPI_PRINT_NOTAG("%X\t", cmd[n]);
+    }
+    RADIOLIB_DEBUG_SPI_PRINTLN_NOTAG();
+  #endif
+
+  // do the transfer, reads have status byte(s) between the command and the data
+  uint8_t spiStatus = 0;
+  size_t padLen = write ? 0 : (this->spiConfig.widths[RADIOLIB_MODULE_SPI_WIDTH_STATUS] / 8);
   this->hal->spiBeginTransaction();
   this->hal->digitalWrite(this->csPin, this->hal->GpioLevelLow);
-  this->hal->spiTransfer(buffOut, buffLen, buffIn);
+  this->SPItransferFrame(cmd, cmdLen, padLen, write ? dataOut : NULL, write ? NULL : dataIn, numBytes, &spiStatus);
   this->hal->digitalWrite(this->csPin, this->hal->GpioLevelHigh);
   this->hal->spiEndTransaction();
 
@@ -371,10 +671,6 @@ int16_t Module::SPItransferStream(uint8_t* cmd, uint8_t cmdLen, bool write, uint
         this->hal->yield();
         if(this->hal->millis() - start >= timeout) {
           RADIOLIB_DEBUG_BASIC_PRINTLN("GPIO post-transfer timeout, is it connected?");
-          #if !RADIOLIB_STATIC_ONLY
-            delete[] buffOut;
-            delete[] buffIn;
-          #endif
           return(RADIOLIB_ERR_SPI_CMD_TIMEOUT);
         }
       }
@@ -384,51 +680,9 @@ int16_t Module::SPItransferStream(uint8_t* cmd, uint8_t cmdLen, bool write, uint
   // parse status
   int16_t state = RADIOLIB_ERR_NONE;
   if((this->spiConfig.parseStatusCb != nullptr) && (numBytes > 0)) {
-    state = this->spiConfig.parseStatusCb(buffIn[this->spiConfig.statusPos]);
-  }
-  
-  // copy the data
-  if(!write) {
-    // skip the status bytes if present
-    memcpy(dataIn, &buffIn[cmdLen + (this->spiConfig.widths[RADIOLIB_MODULE_SPI_WIDTH_STATUS] / 8)], numBytes);
+    state = this->spiConfig.parseStatusCb(spiStatus);
   }
 
-  // print debug information
-  #if RADIOLIB_DEBUG_SPI
-    // print command byte(s)
-    RADIOLIB_DEBUG_SPI_PRINT("CMD");
-    if(write) {
-      RADIOLIB_DEBUG_SPI_PRINT_NOTAG("W\t");
-    } else {
-      RADIOLIB_DEBUG_SPI_PRINT_NOTAG("R\t");
-    }
-    size_t n = 0;
-    for(; n < cmdLen; n++) {
-      RADIOLIB_DEBUG_SPI_PRINT_NOTAG("%X\t", cmd[n]);
-    }
-    RADIOLIB_DEBUG_SPI_PRINTLN_NOTAG();
-
-    // print data bytes
-    RADIOLIB_DEBUG_SPI_PRINT("SI\t");
-    for(n = 0; n < cmdLen; n++) {
-      RADIOLIB_DEBUG_SPI_PRINT_NOTAG("\t");
-    }
-    for(; n < buffLen; n++) {
-      RADIOLIB_DEBUG_SPI_PRINT_NOTAG("%X\t", buffOut[n]);
-    }
-    RADIOLIB_DEBUG_SPI_PRINTLN_NOTAG();
-    RADIOLIB_DEBUG_SPI_PRINT("SO\t");
-    for(n = 0; n < buffLen; n++) {
-      RADIOLIB_DEBUG_SPI_PRINT_NOTAG("%X\t", buffIn[n]);
-    }
-    RADIOLIB_DEBUG_SPI_PRINTLN_NOTAG();
-  #endif
-
-  #if !RADIOLIB_STATIC_ONLY
-    delete[] buffOut;
-    delete[] buffIn;
-  #endif
-
   return(state);
 }
 
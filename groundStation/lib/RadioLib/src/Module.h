@@ -56,6 +56,9 @@
 /*! \def RADIOLIB_MODULE_SPI_WIDTH_STATUS Position of the status width. */
 #define RADIOLIB_MODULE_SPI_WIDTH_STATUS                        (2)
 
+/*! \def RADIOLIB_MODULE_IRQ_TIMESTAMP_SLOTS Number of modules that can have a timestamped interrupt attached at the same time. */
+#define RADIOLIB_MODULE_IRQ_TIMESTAMP_SLOTS                     (2)
+
 /*!
   \}
 */
@@ -232,6 +235,12 @@ class Module {
 
     #endif
 
+    /*!
+      \brief Timestamp of the last interrupt attached by attachTimestampedInterrupt (or of the last IRQ event detected
+      by polling in blocking methods), in microseconds.
+    */
+    volatile uint32_t irqTimestamp = 0;
+
     // basic methods
 
     /*!
@@ -244,6 +253,21 @@ class Module {
     */
     void term();
 
+    /*!
+      \brief Attach an interrupt that records micros() in irqTimestamp before calling the user function.
+      If all RADIOLIB_MODULE_IRQ_TIMESTAMP_SLOTS are taken by other modules, func is attached directly without a timestamp.
+      \param pin Interrupt number (as returned by the HAL pinToInterrupt method).
+      \param func Interrupt service routine to call.
+      \param mode Pin mode.
+    */
+    void attachTimestampedInterrupt(uint32_t pin, void (*func)(void), uint32_t mode);
+
+    /*!
+      \brief Detach an interrupt attached by attachTimestampedInterrupt and release its slot.
+      \param pin Interrupt number.
+    */
+    void detachTimestampedInterrupt(uint32_t pin);
+
     // SPI methods
 
     /*!
@@ -297,6 +321,40 @@ class Module {
     */
     void SPIwriteRegister(uint32_t reg, uint8_t data);
 
+    /*!
+      \brief Mark registers as cacheable in the register shadow cache. Cacheable registers must only be changed by the host,
+      never by the device itself. Their last known value is then used by SPIgetRegValue and SPIsetRegValue instead of an SPI read,
+      and SPIsetRegValue skips writes that would not change the value. Registers at or above RADIOLIB_SPI_REG_CACHE_SIZE are ignored.
+      \param regs Array of register addresses.
+      \param numRegs Number of registers in the array.
+    */
+    void SPIsetRegCacheable(const uint16_t* regs, size_t numRegs);
+
+    /*!
+      \brief Drop all cached register values, e.g. after the device was reset. Registers remain marked as cacheable.
+    */
+    void SPIinvalidateRegCache();
+
+    /*!
+      \brief Drop all cached register values and unmark all cacheable registers, e.g. when the register map changes.
+    */
+    void SPIclearRegCache();
+
+    /*!
+      \brief Start collecting register writes into a batch. While a batch is open, SPIwriteRegister and SPIsetRegValue
+      only queue the write, and SPIgetRegValue returns the queued value. The writes are sent when the batch is ended,
+      with consecutive addresses merged into a single burst transfer. Batches can be nested, only the outermost SPIendBatch flushes.
+      Registers that need time to process a write (e.g. operating mode) should not be written within a batch.
+      Only supported on register access modules, stream-type modules write immediately.
+    */
+    void SPIbeginBatch();
+
+    /*!
+      \brief End a batch started by SPIbeginBatch and send all queued writes.
+      \returns \ref status_codes, RADIOLIB_ERR_SPI_WRITE_FAILED if any of the writes failed verification.
+    */
+    int16_t SPIendBatch();
+
     /*!
       \brief SPI single transfer method.
       \param cmd SPI access command (read/write/burst/...).
@@ -540,6 +598,46 @@ class Module {
 #if !RADIOLIB_GODMODE
   private:
 #endif
+    /*!
+      \brief Clock a complete SPI frame while chip select is already asserted, without dynamic allocation.
+      The frame is made of the header, padLen NOP bytes and numBytes of outgoing data (or NOP bytes if dataOut is NULL).
+      \param header Command and/or address bytes at the start of the frame.
+      \param headerLen Number of header bytes.
+      \param padLen Number of NOP bytes between header and data (e.g. status bytes).
+      \param dataOut Data that will be transferred from master to slave, or NULL to send NOP bytes.
+      \param dataIn Buffer for the numBytes received after header and padding, or NULL to discard them.
+      \param numBytes Number of data bytes.
+      \param status Pointer to store the byte received at spiConfig.statusPos, or NULL.
+    */
+    void SPItransferFrame(uint8_t* header, size_t headerLen, size_t padLen, uint8_t* dataOut, uint8_t* dataIn, size_t numBytes, uint8_t* status);
+
+    #if RADIOLIB_SPI_REG_CACHE_SIZE
+    // register shadow cache, one bit per register in the flag arrays
+    uint8_t regCache[RADIOLIB_SPI_REG_CACHE_SIZE] = { 0 };
+    uint8_t regCacheable[(RADIOLIB_SPI_REG_CACHE_SIZE + 7) / 8] = { 0 };
+    uint8_t regCacheValid[(RADIOLIB_SPI_REG_CACHE_SIZE + 7) / 8] = { 0 };
+    #endif
+
+    bool isRegCacheable(uint32_t reg);
+    bool getCachedReg(uint32_t reg, uint8_t* value);
+    void updateRegCache(uint32_t reg, uint8_t* data, size_t numBytes);
+
+    #if RADIOLIB_SPI_BATCH_SIZE
+    // register writes queued by SPIbeginBatch, checkMask of 0x00 means the write is not verified
+    struct SPIBatchEntry_t {
+      uint16_t reg;
+      uint8_t value;
+      uint8_t checkMask;
+    };
+    SPIBatchEntry_t batch[RADIOLIB_SPI_BATCH_SIZE];
+    size_t batchLen = 0;
+    uint8_t batchDepth = 0;
+    int16_t batchState = RADIOLIB_ERR_NONE;
+    #endif
+
+    bool queueRegWrite(uint32_t reg, uint8_t value, uint8_t checkMask);
+    void flushBatch();
+
     uint32_t csPin = RADIOLIB_NC;
     uint32_t irqPin = RADIOLIB_NC;
     uint32_t rstPin = RADIOLIB_NC;
@@ -106,10 +106,15 @@
 #include "protocols/Print/Print.h"
 #include "protocols/BellModem/BellModem.h"
 #include "protocols/LoRaWAN/LoRaWAN.h"
+#include "protocols/TransmitQueue/TransmitQueue.h"
+#include "protocols/LinkAdr/LinkAdr.h"
+#include "protocols/LinkAggregation/LinkAggregation.h"
 
 // utilities
 #include "utils/CRC.h"
 #include "utils/Cryptography.h"
+#include "utils/PacketQueue.h"
+#include "utils/AirtimeBudget.h"
 
 // only create Radio class when using RadioShield
 #if RADIOLIB_RADIOSHIELD
@@ -250,6 +250,31 @@
 */
 #define RADIOLIB_ERR_NULL_POINTER                              (-28)
 
+/*!
+  \brief Packet queue is full, the received packet was discarded.
+*/
+#define RADIOLIB_ERR_QUEUE_FULL                                (-29)
+
+/*!
+  \brief Received packet is not a valid link rate feedback packet.
+*/
+#define RADIOLIB_ERR_INVALID_FEEDBACK                          (-30)
+
+/*!
+  \brief Received packet is not a valid aggregated or fragmented link packet, or a fragment is missing.
+*/
+#define RADIOLIB_ERR_INVALID_LINK_PACKET                       (-31)
+
+/*!
+  \brief Airtime window or limit is invalid, or the packet is longer than the airtime limit.
+*/
+#define RADIOLIB_ERR_INVALID_DUTY_CYCLE                        (-32)
+
+/*!
+  \brief Queued packet was discarded because its deadline passed before it could be sent.
+*/
+#define RADIOLIB_ERR_DEADLINE_EXPIRED                          (-33)
+
 // RF69-specific status codes
 
 /*!
@@ -481,6 +506,11 @@
 */
 #define RADIOLIB_ERR_INVALID_FUNCTION                           (-1003)
 
+/*!
+  \brief The received code word has more bit errors than can be corrected.
+*/
+#define RADIOLIB_ERR_UNCORRECTABLE_CODE_WORD                    (-1004)
+
 // LoRaWAN-specific status codes
 
 /*!
@@ -254,6 +254,7 @@ int16_t SX126x::transmit(uint8_t* data, size_t len, uint8_t addr) {
       return(RADIOLIB_ERR_TX_TIMEOUT);
     }
   }
+  this->mod->irqTimestamp = this->mod->hal->micros();
 
   // update data rate
   uint32_t elapsed = this->mod->hal->millis() - start;
@@ -308,6 +309,7 @@ int16_t SX126x::receive(uint8_t* data, size_t len) {
       break;
     }
   }
+  this->mod->irqTimestamp = this->mod->hal->micros();
 
   // if it was a timeout, this will return an error code
   state = standby();
@@ -475,11 +477,11 @@ int16_t SX126x::standby(uint8_t mode, bool wakeup) {
 }
 
 void SX126x::setDio1Action(void (*func)(void)) {
-  this->mod->hal->attachInterrupt(this->mod->hal->pinToInterrupt(this->mod->getIrq()), func, this->mod->hal->GpioInterruptRising);
+  this->mod->attachTimestampedInterrupt(this->mod->hal->pinToInterrupt(this->mod->getIrq()), func, this->mod->hal->GpioInterruptRising);
 }
 
 void SX126x::clearDio1Action() {
-  this->mod->hal->detachInterrupt(this->mod->hal->pinToInterrupt(this->mod->getIrq()));
+  this->mod->detachTimestampedInterrupt(this->mod->hal->pinToInterrupt(this->mod->getIrq()));
 }
 
 void SX126x::setPacketReceivedAction(void (*func)(void)) {
@@ -1359,6 +1361,13 @@ float SX126x::getSNR() {
   }
 }
 
+int16_t SX126x::getPacketInfo(RadioLibPacketInfo_t* info) {
+  int16_t state = PhysicalLayer::getPacketInfo(info);
+  RADIOLIB_ASSERT(state);
+  info->freqError = getFrequencyError();
+  return(state);
+}
+
 float SX126x::getFrequencyError() {
   // check active modem
   uint8_t modem = getPacketType();
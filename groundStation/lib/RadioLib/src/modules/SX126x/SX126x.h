@@ -931,6 +931,13 @@ class SX126x: public PhysicalLayer {
     */
     float getFrequencyError();
 
+    /*!
+      \brief Gets the metadata of the last packet: interrupt timestamp, RSSI, SNR and frequency error.
+      \param info Pointer to structure to save the metadata to.
+      \returns \ref status_codes
+    */
+    int16_t getPacketInfo(RadioLibPacketInfo_t* info) override;
+
     /*!
       \brief Query modem for the packet length of received payload.
       \param update Update received packet length. Will return cached value when set to false.
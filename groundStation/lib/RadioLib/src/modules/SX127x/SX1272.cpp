@@ -80,6 +80,10 @@ void SX1272::reset() {
   mod->hal->delay(1);
   mod->hal->digitalWrite(mod->getRst(), mod->hal->GpioLevelLow);
   mod->hal->delay(5);
+
+  // all registers are back to their reset values
+  mod->SPIclearRegCache();
+  this->txPrepared = false;
 }
 
 int16_t SX1272::setFrequency(float freq) {
@@ -484,6 +488,9 @@ int16_t SX1272::explicitHeader() {
 }
 
 int16_t SX1272::setBandwidthRaw(uint8_t newBandwidth) {
+  // errata fixes applied by prepareTransmit depend on the bandwidth
+  this->txPrepared = false;
+
   // set mode to standby
   int16_t state = SX127x::standby();
 
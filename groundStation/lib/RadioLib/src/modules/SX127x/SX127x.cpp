@@ -33,6 +33,8 @@ int16_t SX127x::begin(uint8_t* chipVersions, uint8_t numVersions, uint8_t syncWo
     // set LoRa mode
     state = setActiveModem(RADIOLIB_SX127X_LORA);
     RADIOLIB_ASSERT(state);
+  } else {
+    cacheRegisters(RADIOLIB_SX127X_LORA);
   }
 
   // set LoRa sync word
@@ -80,6 +82,8 @@ int16_t SX127x::beginFSK(uint8_t* chipVersions, uint8_t numVersions, float freqD
     // set FSK mode
     state = setActiveModem(RADIOLIB_SX127X_FSK_OOK);
     RADIOLIB_ASSERT(state);
+  } else {
+    cacheRegisters(RADIOLIB_SX127X_FSK_OOK);
   }
 
   // enable/disable OOK
@@ -177,6 +181,7 @@ int16_t SX127x::transmit(uint8_t* data, size_t len, uint8_t addr) {
       return(RADIOLIB_ERR_TX_TIMEOUT);
     }
   }
+  this->mod->irqTimestamp = this->mod->hal->micros();
 
   // update data rate
   uint32_t elapsed = this->mod->hal->millis() - start;
@@ -242,6 +247,7 @@ int16_t SX127x::receive(uint8_t* data, size_t len) {
       }
     }
   }
+  this->mod->irqTimestamp = this->mod->hal->micros();
 
   // read the received data
   state = readData(data, len);
@@ -372,6 +378,9 @@ int16_t SX127x::startReceive(uint8_t len, uint8_t mode) {
 
   int16_t modem = getActiveModem();
   if(modem == RADIOLIB_SX127X_LORA) {
+    // collect the configuration writes
+    this->mod->SPIbeginBatch();
+
     // set DIO pin mapping
     if(this->mod->SPIgetRegValue(RADIOLIB_SX127X_REG_HOP_PERIOD) > RADIOLIB_SX127X_HOP_PERIOD_OFF) {
       state = this->mod->SPIsetRegValue(RADIOLIB_SX127X_REG_DIO_MAPPING_1, RADIOLIB_SX127X_DIO0_LORA_RX_DONE | RADIOLIB_SX127X_DIO1_LORA_FHSS_CHANGE_CHANNEL, 7, 4);
@@ -394,6 +403,7 @@ int16_t SX127x::startReceive(uint8_t len, uint8_t mode) {
     // set FIFO pointers
     state |= this->mod->SPIsetRegValue(RADIOLIB_SX127X_REG_FIFO_RX_BASE_ADDR, RADIOLIB_SX127X_FIFO_RX_BASE_ADDR_MAX);
     state |= this->mod->SPIsetRegValue(RADIOLIB_SX127X_REG_FIFO_ADDR_PTR, RADIOLIB_SX127X_FIFO_RX_BASE_ADDR_MAX);
+    state |= this->mod->SPIendBatch();
     RADIOLIB_ASSERT(state);
 
   } else if(modem == RADIOLIB_SX127X_FSK_OOK) {
@@ -436,11 +446,11 @@ int16_t SX127x::startReceive(uint32_t timeout, uint16_t irqFlags, uint16_t irqMa
 }
 
 void SX127x::setDio0Action(void (*func)(void), uint32_t dir) {
-  this->mod->hal->attachInterrupt(this->mod->hal->pinToInterrupt(this->mod->getIrq()), func, dir);
+  this->mod->attachTimestampedInterrupt(this->mod->hal->pinToInterrupt(this->mod->getIrq()), func, dir);
 }
 
 void SX127x::clearDio0Action() {
-  this->mod->hal->detachInterrupt(this->mod->hal->pinToInterrupt(this->mod->getIrq()));
+  this->mod->detachTimestampedInterrupt(this->mod->hal->pinToInterrupt(this->mod->getIrq()));
 }
 
 void SX127x::setDio1Action(void (*func)(void), uint32_t dir) {
@@ -550,8 +560,10 @@ bool SX127x::fifoGet(volatile uint8_t* data, int totalLen, volatile int* rcvLen)
 }
 
 int16_t SX127x::startTransmit(uint8_t* data, size_t len, uint8_t addr) {
-  // set mode to standby
-  int16_t state = setMode(RADIOLIB_SX127X_STANDBY);
+  // LoRa transmissions reuse the configuration set by prepareTransmit until something changes it
+  if(this->txPrepared) {
+    return(startPreparedTransmit(data, len));
+  }
 
   int16_t modem = getActiveModem();
   if(modem == RADIOLIB_SX127X_LORA) {
@@ -560,27 +572,16 @@ int16_t SX127x::startTransmit(uint8_t* data, size_t len, uint8_t addr) {
       return(RADIOLIB_ERR_PACKET_TOO_LONG);
     }
 
-    // set DIO mapping
-    if(this->mod->SPIgetRegValue(RADIOLIB_SX127X_REG_HOP_PERIOD) > RADIOLIB_SX127X_HOP_PERIOD_OFF) {
-      this->mod->SPIsetRegValue(RADIOLIB_SX127X_REG_DIO_MAPPING_1, RADIOLIB_SX127X_DIO0_LORA_TX_DONE | RADIOLIB_SX127X_DIO1_LORA_FHSS_CHANGE_CHANNEL, 7, 4);
-    } else {
-      this->mod->SPIsetRegValue(RADIOLIB_SX127X_REG_DIO_MAPPING_1, RADIOLIB_SX127X_DIO0_LORA_TX_DONE, 7, 6);
-    }
-
-    // apply fixes to errata
-    RADIOLIB_ERRATA_SX127X(false);
-
-    // clear interrupt flags
-    clearIRQFlags();
-
-    // set packet length
-    state |= this->mod->SPIsetRegValue(RADIOLIB_SX127X_REG_PAYLOAD_LENGTH, len);
+    // prepareTransmit also sets the mode to standby
+    int16_t state = prepareTransmit();
+    RADIOLIB_ASSERT(state);
+    return(startPreparedTransmit(data, len));
+  }
 
-    // set FIFO pointers
-    state |= this->mod->SPIsetRegValue(RADIOLIB_SX127X_REG_FIFO_TX_BASE_ADDR, RADIOLIB_SX127X_FIFO_TX_BASE_ADDR_MAX);
-    state |= this->mod->SPIsetRegValue(RADIOLIB_SX127X_REG_FIFO_ADDR_PTR, RADIOLIB_SX127X_FIFO_TX_BASE_ADDR_MAX);
+  // set mode to standby
+  int16_t state = setMode(RADIOLIB_SX127X_STANDBY);
 
-  } else if(modem == RADIOLIB_SX127X_FSK_OOK) {
+  if(modem == RADIOLIB_SX127X_FSK_OOK) {
     // clear interrupt flags
     clearIRQFlags();
 
@@ -621,17 +622,95 @@ int16_t SX127x::startTransmit(uint8_t* data, size_t len, uint8_t addr) {
   return(RADIOLIB_ERR_NONE);
 }
 
+int16_t SX127x::prepareTransmit() {
+  // set mode to standby
+  int16_t state = setMode(RADIOLIB_SX127X_STANDBY);
+  RADIOLIB_ASSERT(state);
+
+  // only LoRa has a configuration that stays the same between packets
+  if(getActiveModem() != RADIOLIB_SX127X_LORA) {
+    return(RADIOLIB_ERR_WRONG_MODEM);
+  }
+
+  // collect the configuration writes, they are sent in as few transfers as possible
+  this->mod->SPIbeginBatch();
+
+  // set DIO mapping
+  if(this->mod->SPIgetRegValue(RADIOLIB_SX127X_REG_HOP_PERIOD) > RADIOLIB_SX127X_HOP_PERIOD_OFF) {
+    this->mod->SPIsetRegValue(RADIOLIB_SX127X_REG_DIO_MAPPING_1, RADIOLIB_SX127X_DIO0_LORA_TX_DONE | RADIOLIB_SX127X_DIO1_LORA_FHSS_CHANGE_CHANNEL, 7, 4);
+  } else {
+    this->mod->SPIsetRegValue(RADIOLIB_SX127X_REG_DIO_MAPPING_1, RADIOLIB_SX127X_DIO0_LORA_TX_DONE, 7, 6);
+  }
+
+  // apply fixes to errata
+  RADIOLIB_ERRATA_SX127X(false);
+
+  // clear interrupt flags
+  clearIRQFlags();
+
+  // set FIFO base address, the FIFO pointer is reset to it for every packet
+  state = this->mod->SPIsetRegValue(RADIOLIB_SX127X_REG_FIFO_TX_BASE_ADDR, RADIOLIB_SX127X_FIFO_TX_BASE_ADDR_MAX);
+  state |= this->mod->SPIendBatch();
+  RADIOLIB_ASSERT(state);
+
+  // the errata fix may have changed the mode, so only now mark the radio as prepared
+  this->txPrepared = true;
+  this->txReady = true;
+  return(state);
+}
+
+int16_t SX127x::startPreparedTransmit(uint8_t* data, size_t len) {
+  // check packet length
+  if(len > RADIOLIB_SX127X_MAX_PACKET_LENGTH) {
+    return(RADIOLIB_ERR_PACKET_TOO_LONG);
+  }
+
+  // unless finishTransmit was called, the previous packet may still be in progress or have its flags set
+  int16_t state = RADIOLIB_ERR_NONE;
+  if(!this->txReady) {
+    state = setMode(RADIOLIB_SX127X_STANDBY);
+    RADIOLIB_ASSERT(state);
+    clearIRQFlags();
+  }
+
+  // set packet length and reset the FIFO pointer
+  this->mod->SPIbeginBatch();
+  state = this->mod->SPIsetRegValue(RADIOLIB_SX127X_REG_PAYLOAD_LENGTH, len);
+  state |= this->mod->SPIsetRegValue(RADIOLIB_SX127X_REG_FIFO_ADDR_PTR, RADIOLIB_SX127X_FIFO_TX_BASE_ADDR_MAX);
+  state |= this->mod->SPIendBatch();
+  RADIOLIB_ASSERT(state);
+
+  // write packet to FIFO
+  this->mod->SPIwriteRegisterBurst(RADIOLIB_SX127X_REG_FIFO, data, len);
+
+  // set RF switch (if present)
+  this->mod->setRfSwitchState(Module::MODE_TX);
+
+  // start transmission
+  return(setMode(RADIOLIB_SX127X_TX));
+}
+
 int16_t SX127x::finishTransmit() {
-  // wait for at least 1 bit at the lowest possible bit rate before clearing IRQ flags
+  // in FSK/OOK mode, wait for at least 1 bit at the current bit rate before clearing IRQ flags
   // not doing this and clearing RADIOLIB_SX127X_FLAG_FIFO_OVERRUN will dump the FIFO,
   // which can lead to mangling of the last bit (#808)
-  mod->hal->delayMicroseconds(1000000/1200);
+  // LoRa has no such flag, and a prepared transmission is always LoRa, so the modem check can be skipped
+  if(!this->txPrepared && (getActiveModem() == RADIOLIB_SX127X_FSK_OOK)) {
+    // bit rate is in kbps, fall back to the lowest common one (1.2 kbps) if it was never set
+    float br = (this->bitRate > 0) ? this->bitRate : 1.2;
+    this->mod->hal->delayMicroseconds((uint32_t)(1000.0 / br) + 1);
+  }
 
   // clear interrupt flags
   clearIRQFlags();
 
   // set mode to standby to disable transmitter/RF switch
-  return(standby());
+  int16_t state = standby();
+  RADIOLIB_ASSERT(state);
+
+  // the next prepared packet can be loaded straight away
+  this->txReady = this->txPrepared;
+  return(state);
 }
 
 int16_t SX127x::readData(uint8_t* data, size_t len) {
@@ -660,6 +739,10 @@ int16_t SX127x::readData(uint8_t* data, size_t len) {
       state = RADIOLIB_ERR_LORA_HEADER_DAMAGED;
     }
 
+    // in continuous mode packets are stored one after another, so start at the latest one
+    // in case an earlier packet was never read
+    this->mod->SPIwriteRegister(RADIOLIB_SX127X_REG_FIFO_ADDR_PTR, this->mod->SPIreadRegister(RADIOLIB_SX127X_REG_FIFO_RX_CURRENT_ADDR));
+
   } else if(modem == RADIOLIB_SX127X_FSK_OOK) {
     // check address filtering
     uint8_t filter = this->mod->SPIgetRegValue(RADIOLIB_SX127X_REG_PACKET_CONFIG_1, 2, 1);
@@ -802,6 +885,13 @@ int16_t SX127x::invertPreamble(bool enable) {
   return(RADIOLIB_ERR_UNKNOWN);
 }
 
+int16_t SX127x::getPacketInfo(RadioLibPacketInfo_t* info) {
+  int16_t state = PhysicalLayer::getPacketInfo(info);
+  RADIOLIB_ASSERT(state);
+  info->freqError = getFrequencyError();
+  return(state);
+}
+
 float SX127x::getFrequencyError(bool autoCorrect) {
   int16_t modem = getActiveModem();
   if(modem == RADIOLIB_SX127X_LORA) {
@@ -1167,6 +1257,9 @@ int16_t SX127x::setOOK(bool enableOOK) {
 int16_t SX127x::setFrequencyRaw(float newFreq) {
   int16_t state = RADIOLIB_ERR_NONE;
 
+  // errata fixes applied by prepareTransmit depend on the frequency
+  this->txPrepared = false;
+
   // set mode to standby if not FHSS
   if(this->mod->SPIgetRegValue(RADIOLIB_SX127X_REG_HOP_PERIOD) == RADIOLIB_SX127X_HOP_PERIOD_OFF) {
     state = setMode(RADIOLIB_SX127X_STANDBY);
@@ -1175,10 +1268,12 @@ int16_t SX127x::setFrequencyRaw(float newFreq) {
   // calculate register values
   uint32_t FRF = (newFreq * (uint32_t(1) << RADIOLIB_SX127X_DIV_EXPONENT)) / RADIOLIB_SX127X_CRYSTAL_FREQ;
 
-  // write registers
+  // write registers, as a single burst so that the frequency changes at once
+  this->mod->SPIbeginBatch();
   state |= this->mod->SPIsetRegValue(RADIOLIB_SX127X_REG_FRF_MSB, (FRF & 0xFF0000) >> 16);
   state |= this->mod->SPIsetRegValue(RADIOLIB_SX127X_REG_FRF_MID, (FRF & 0x00FF00) >> 8);
   state |= this->mod->SPIsetRegValue(RADIOLIB_SX127X_REG_FRF_LSB, FRF & 0x0000FF);
+  state |= this->mod->SPIendBatch();
   return(state);
 }
 
@@ -1566,6 +1661,12 @@ bool SX127x::findChip(uint8_t* vers, uint8_t num) {
 }
 
 int16_t SX127x::setMode(uint8_t mode) {
+  // receiving and channel scanning change the DIO mapping and frequency set by prepareTransmit
+  this->txReady = false;
+  if((mode != RADIOLIB_SX127X_STANDBY) && (mode != RADIOLIB_SX127X_SLEEP) && (mode != RADIOLIB_SX127X_TX)) {
+    this->txPrepared = false;
+  }
+
   uint8_t checkMask = 0xFF;
   if((getActiveModem() == RADIOLIB_SX127X_FSK_OOK) && (mode == RADIOLIB_SX127X_RX)) {
     // disable checking of RX bit in FSK RX mode, as it sometimes seem to fail (#276)
@@ -1579,6 +1680,10 @@ int16_t SX127x::getActiveModem() {
 }
 
 int16_t SX127x::setActiveModem(uint8_t modem) {
+  // registers 0x0D - 0x3F change meaning with the modem, so stop caching until the switch is done
+  this->mod->SPIclearRegCache();
+  this->txPrepared = false;
+
   // set mode to SLEEP
   int16_t state = setMode(RADIOLIB_SX127X_SLEEP);
 
@@ -1587,9 +1692,46 @@ int16_t SX127x::setActiveModem(uint8_t modem) {
 
   // set mode to STANDBY
   state |= setMode(RADIOLIB_SX127X_STANDBY);
+  RADIOLIB_ASSERT(state);
+
+  cacheRegisters(modem);
   return(state);
 }
 
+void SX127x::cacheRegisters(uint8_t modem) {
+  // configuration registers that are only ever changed by the host, for both modems
+  static const uint16_t commonRegs[] = {
+    RADIOLIB_SX127X_REG_FRF_MSB, RADIOLIB_SX127X_REG_FRF_MID, RADIOLIB_SX127X_REG_FRF_LSB,
+    RADIOLIB_SX127X_REG_PA_CONFIG, RADIOLIB_SX127X_REG_PA_RAMP, RADIOLIB_SX127X_REG_OCP,
+    RADIOLIB_SX127X_REG_DIO_MAPPING_1, RADIOLIB_SX127X_REG_DIO_MAPPING_2,
+  };
+  static const uint16_t loraRegs[] = {
+    RADIOLIB_SX127X_REG_FIFO_TX_BASE_ADDR, RADIOLIB_SX127X_REG_FIFO_RX_BASE_ADDR, RADIOLIB_SX127X_REG_IRQ_FLAGS_MASK,
+    RADIOLIB_SX127X_REG_MODEM_CONFIG_1, RADIOLIB_SX127X_REG_MODEM_CONFIG_2, RADIOLIB_SX127X_REG_SYMB_TIMEOUT_LSB,
+    RADIOLIB_SX127X_REG_PREAMBLE_MSB, RADIOLIB_SX127X_REG_PREAMBLE_LSB,
+    RADIOLIB_SX127X_REG_PAYLOAD_LENGTH, RADIOLIB_SX127X_REG_MAX_PAYLOAD_LENGTH, RADIOLIB_SX127X_REG_HOP_PERIOD,
+    RADIOLIB_SX127X_REG_DETECT_OPTIMIZE, RADIOLIB_SX127X_REG_INVERT_IQ, RADIOLIB_SX127X_REG_DETECTION_THRESHOLD,
+    RADIOLIB_SX127X_REG_SYNC_WORD, RADIOLIB_SX127X_REG_INVERT_IQ2,
+  };
+  static const uint16_t fskRegs[] = {
+    RADIOLIB_SX127X_REG_BITRATE_MSB, RADIOLIB_SX127X_REG_BITRATE_LSB, RADIOLIB_SX127X_REG_FDEV_MSB, RADIOLIB_SX127X_REG_FDEV_LSB,
+    RADIOLIB_SX127X_REG_RSSI_THRESH, RADIOLIB_SX127X_REG_RX_BW, RADIOLIB_SX127X_REG_AFC_BW, RADIOLIB_SX127X_REG_PREAMBLE_DETECT,
+    RADIOLIB_SX127X_REG_PREAMBLE_MSB_FSK, RADIOLIB_SX127X_REG_PREAMBLE_LSB_FSK, RADIOLIB_SX127X_REG_SYNC_CONFIG,
+    RADIOLIB_SX127X_REG_SYNC_VALUE_1, RADIOLIB_SX127X_REG_SYNC_VALUE_2, RADIOLIB_SX127X_REG_SYNC_VALUE_3, RADIOLIB_SX127X_REG_SYNC_VALUE_4,
+    RADIOLIB_SX127X_REG_SYNC_VALUE_5, RADIOLIB_SX127X_REG_SYNC_VALUE_6, RADIOLIB_SX127X_REG_SYNC_VALUE_7, RADIOLIB_SX127X_REG_SYNC_VALUE_8,
+    RADIOLIB_SX127X_REG_PACKET_CONFIG_1, RADIOLIB_SX127X_REG_PACKET_CONFIG_2, RADIOLIB_SX127X_REG_PAYLOAD_LENGTH_FSK,
+    RADIOLIB_SX127X_REG_NODE_ADRS, RADIOLIB_SX127X_REG_BROADCAST_ADRS, RADIOLIB_SX127X_REG_FIFO_THRESH,
+  };
+
+  this->mod->SPIclearRegCache();
+  this->mod->SPIsetRegCacheable(commonRegs, sizeof(commonRegs) / sizeof(commonRegs[0]));
+  if(modem == RADIOLIB_SX127X_LORA) {
+    this->mod->SPIsetRegCacheable(loraRegs, sizeof(loraRegs) / sizeof(loraRegs[0]));
+  } else if(modem == RADIOLIB_SX127X_FSK_OOK) {
+    this->mod->SPIsetRegCacheable(fskRegs, sizeof(fskRegs) / sizeof(fskRegs[0]));
+  }
+}
+
 void SX127x::clearIRQFlags() {
   int16_t modem = getActiveModem();
   if(modem == RADIOLIB_SX127X_LORA) {
@@ -1640,6 +1782,7 @@ void SX127x::readBit(uint32_t pin) {
 #endif
 
 int16_t SX127x::setFHSSHoppingPeriod(uint8_t freqHoppingPeriod) {
+  this->txPrepared = false;
   return(this->mod->SPIsetRegValue(RADIOLIB_SX127X_REG_HOP_PERIOD, freqHoppingPeriod));
 }
 
@@ -1661,6 +1804,7 @@ void SX127x::clearFHSSInt(void) {
 }
 
 int16_t SX127x::setDIOMapping(uint32_t pin, uint32_t value) {
+  this->txPrepared = false;
   if (pin > 5)
     return RADIOLIB_ERR_INVALID_DIO_PIN;
 
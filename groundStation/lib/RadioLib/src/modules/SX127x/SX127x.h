@@ -799,6 +799,15 @@ class SX127x: public PhysicalLayer {
     */
     int16_t startTransmit(uint8_t* data, size_t len, uint8_t addr = 0) override;
 
+    /*!
+      \brief Prepares the radio for repeated %LoRa transmissions: sets DIO mapping, errata fixes and FIFO base address once,
+      so that every following startTransmit only writes the payload length, the FIFO and the mode.
+      Called automatically by the first %LoRa startTransmit, the configuration is kept until a method that changes it
+      (e.g. receiving, channel scan, frequency, bandwidth, DIO mapping or modem change) is called.
+      \returns \ref status_codes
+    */
+    int16_t prepareTransmit();
+
     /*!
       \brief Clean up after transmission is done.
       \returns \ref status_codes
@@ -894,6 +903,13 @@ class SX127x: public PhysicalLayer {
     */
     float getFrequencyError(bool autoCorrect = false);
 
+    /*!
+      \brief Gets the metadata of the last packet: interrupt timestamp, RSSI, SNR and frequency error.
+      \param info Pointer to structure to save the metadata to.
+      \returns \ref status_codes
+    */
+    int16_t getPacketInfo(RadioLibPacketInfo_t* info) override;
+
     /*!
       \brief Gets current AFC error.
       \returns Frequency offset from RF in Hz if AFC is enabled and triggered, zero otherwise.
@@ -1233,6 +1249,7 @@ class SX127x: public PhysicalLayer {
     uint8_t codingRate = 0;
     bool crcEnabled = false;
     bool ookEnabled = false;
+    bool txPrepared = false;
 
     int16_t configFSK();
     int16_t getActiveModem();
@@ -1250,13 +1267,16 @@ class SX127x: public PhysicalLayer {
     float dataRate = 0;
     bool packetLengthQueried = false; // FSK packet length is the first byte in FIFO, length can only be queried once
     uint8_t packetLengthConfig = RADIOLIB_SX127X_PACKET_VARIABLE;
+    bool txReady = false; // in standby with interrupt flags cleared, next prepared packet can be loaded right away
 
     int16_t config();
     int16_t directMode();
     int16_t setPacketMode(uint8_t mode, uint8_t len);
     bool findChip(uint8_t* vers, uint8_t num);
     int16_t setMode(uint8_t mode);
+    int16_t startPreparedTransmit(uint8_t* data, size_t len);
     int16_t setActiveModem(uint8_t modem);
+    void cacheRegisters(uint8_t modem);
     void clearIRQFlags();
     void clearFIFO(size_t count); // used mostly to clear remaining bytes in FIFO after a packet read
 
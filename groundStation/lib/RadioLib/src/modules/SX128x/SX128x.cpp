@@ -334,6 +334,7 @@ int16_t SX128x::transmit(uint8_t* data, size_t len, uint8_t addr) {
       return(RADIOLIB_ERR_TX_TIMEOUT);
     }
   }
+  this->mod->irqTimestamp = this->mod->hal->micros();
 
   return(finishTransmit());
 }
@@ -369,6 +370,7 @@ int16_t SX128x::receive(uint8_t* data, size_t len) {
       break;
     }
   }
+  this->mod->irqTimestamp = this->mod->hal->micros();
 
   // if it was a timeout, this will return an error code
   state = standby();
@@ -489,11 +491,11 @@ int16_t SX128x::standby(uint8_t mode, bool wakeup) {
 }
 
 void SX128x::setDio1Action(void (*func)(void)) {
-  this->mod->hal->attachInterrupt(this->mod->hal->pinToInterrupt(this->mod->getIrq()), func, this->mod->hal->GpioInterruptRising);
+  this->mod->attachTimestampedInterrupt(this->mod->hal->pinToInterrupt(this->mod->getIrq()), func, this->mod->hal->GpioInterruptRising);
 }
 
 void SX128x::clearDio1Action() {
-  this->mod->hal->detachInterrupt(this->mod->hal->pinToInterrupt(this->mod->getIrq()));
+  this->mod->detachTimestampedInterrupt(this->mod->hal->pinToInterrupt(this->mod->getIrq()));
 }
 
 void SX128x::setPacketReceivedAction(void (*func)(void)) {
@@ -1189,6 +1191,13 @@ float SX128x::getSNR() {
   }
 }
 
+int16_t SX128x::getPacketInfo(RadioLibPacketInfo_t* info) {
+  int16_t state = PhysicalLayer::getPacketInfo(info);
+  RADIOLIB_ASSERT(state);
+  info->freqError = getFrequencyError();
+  return(state);
+}
+
 float SX128x::getFrequencyError() {
   // check active modem
   uint8_t modem = getPacketType();
@@ -0,0 +1,137 @@
+#include "LinkAdr.h"
+#include <math.h>
+
+#if !RADIOLIB_EXCLUDE_LINK_ADR
+
+// default ladder, each step costs roughly 2.5 - 3 dB of SNR
+static const DataRate_t LinkAdrDefaultRates[] = {
+  { { 12, 62.5, 8 } },
+  { { 11, 62.5, 8 } },
+  { { 10, 62.5, 6 } },
+  { { 9, 62.5, 6 } },
+  { { 9, 125.0, 5 } },
+  { { 8, 125.0, 5 } },
+  { { 7, 125.0, 5 } },
+  { { 7, 250.0, 5 } },
+};
+
+LinkAdrClient::LinkAdrClient(PhysicalLayer* phy) {
+  phyLayer = phy;
+  rates = LinkAdrDefaultRates;
+  numRates = sizeof(LinkAdrDefaultRates) / sizeof(LinkAdrDefaultRates[0]);
+  index = 0;
+  targetMargin = RADIOLIB_LINK_ADR_MARGIN_DB;
+  minSnr = 0;
+  numSnr = 0;
+  margin = 0;
+}
+
+int16_t LinkAdrClient::begin(const DataRate_t* rates, uint8_t numRates, float margin) {
+  if(rates != NULL) {
+    if((numRates == 0) || (numRates > RADIOLIB_LINK_ADR_MAX_RATES)) {
+      return(RADIOLIB_ERR_INVALID_DATA_RATE);
+    }
+    this->rates = rates;
+    this->numRates = numRates;
+  }
+  this->targetMargin = margin;
+
+  // make sure the radio can use every rate before relying on any of them
+  for(uint8_t i = 0; i < this->numRates; i++) {
+    int16_t state = this->phyLayer->checkDataRate(this->rates[i]);
+    RADIOLIB_ASSERT(state);
+  }
+
+  return(setIndex(0));
+}
+
+int16_t LinkAdrClient::setIndex(uint8_t index) {
+  if(index >= this->numRates) {
+    return(RADIOLIB_ERR_INVALID_DATA_RATE);
+  }
+
+  int16_t state = this->phyLayer->setDataRate(this->rates[index]);
+  RADIOLIB_ASSERT(state);
+
+  // SNR seen at the previous rate says nothing about the new one
+  this->index = index;
+  this->numSnr = 0;
+  return(state);
+}
+
+uint8_t LinkAdrClient::getIndex() const {
+  return(this->index);
+}
+
+int16_t LinkAdrClient::fallback() {
+  return(setIndex(0));
+}
+
+uint8_t LinkAdrClient::update(float snr) {
+  // track the worst SNR of the current window
+  if((this->numSnr == 0) || (snr < this->minSnr)) {
+    this->minSnr = snr;
+  }
+  this->numSnr++;
+  this->margin = this->minSnr - getSnrFloor(this->rates[this->index].lora.spreadingFactor) - this->targetMargin;
+
+  // step down straight away when the margin is gone
+  if(this->margin < 0) {
+    this->numSnr = 0;
+    return((this->index > 0) ? this->index - 1 : 0);
+  }
+
+  // only step up once the whole window had margin to spare
+  if(this->numSnr < RADIOLIB_LINK_ADR_HISTORY) {
+    return(this->index);
+  }
+  this->numSnr = 0;
+  if((this->index + 1 < this->numRates) && (this->margin >= getStepCost(this->index, this->index + 1))) {
+    return(this->index + 1);
+  }
+  return(this->index);
+}
+
+float LinkAdrClient::getMargin() const {
+  return(this->margin);
+}
+
+uint8_t LinkAdrClient::getHeader(bool feedback) const {
+  uint8_t header = this->index & RADIOLIB_LINK_ADR_HEADER_INDEX;
+  if(feedback) {
+    header |= RADIOLIB_LINK_ADR_HEADER_FEEDBACK;
+  }
+  return(header);
+}
+
+size_t LinkAdrClient::buildFeedback(uint8_t* buff, uint8_t index) const {
+  buff[0] = RADIOLIB_LINK_ADR_FEEDBACK_MAGIC;
+  buff[1] = index;
+  return(RADIOLIB_LINK_ADR_FEEDBACK_LEN);
+}
+
+int16_t LinkAdrClient::parseFeedback(const uint8_t* buff, size_t len, uint8_t* index) const {
+  if((len != RADIOLIB_LINK_ADR_FEEDBACK_LEN) || (buff[0] != RADIOLIB_LINK_ADR_FEEDBACK_MAGIC)) {
+    return(RADIOLIB_ERR_INVALID_FEEDBACK);
+  }
+  if(buff[1] >= this->numRates) {
+    return(RADIOLIB_ERR_INVALID_DATA_RATE);
+  }
+  *index = buff[1];
+  return(RADIOLIB_ERR_NONE);
+}
+
+float LinkAdrClient::getSnrFloor(uint8_t sf) {
+  // demodulation floor from the SX127x datasheet: -5 dB at SF6, 2.5 dB lower for each SF step
+  return(-5.0 - 2.5*(float)(sf - 6));
+}
+
+float LinkAdrClient::getStepCost(uint8_t from, uint8_t to) const {
+  // SNR is measured in-band, so a wider bandwidth also lets in proportionally more noise
+  // coding rate changes the sensitivity by about 1 dB at most and is not accounted for
+  const LoRaRate_t& a = this->rates[from].lora;
+  const LoRaRate_t& b = this->rates[to].lora;
+  return(getSnrFloor(b.spreadingFactor) - getSnrFloor(a.spreadingFactor) + 10.0*log10(b.bandwidth / a.bandwidth));
+}
+
+#endif
@@ -0,0 +1,125 @@
+#if !defined(_RADIOLIB_LINK_ADR_H) && !RADIOLIB_EXCLUDE_LINK_ADR
+#define _RADIOLIB_LINK_ADR_H
+
+#include "../../TypeDef.h"
+#include "../PhysicalLayer/PhysicalLayer.h"
+
+// number of packets the receiver has to see at the current rate before it may recommend a faster one
+#define RADIOLIB_LINK_ADR_HISTORY                               (4)
+
+// SNR margin in dB to keep above the demodulation floor, absorbs fading between decisions
+#define RADIOLIB_LINK_ADR_MARGIN_DB                             (5.0)
+
+// link header, prepended to every uplink packet
+#define RADIOLIB_LINK_ADR_HEADER_LEN                            (1)
+#define RADIOLIB_LINK_ADR_HEADER_FEEDBACK                       (0x80)  //  7     7   receiver should reply with feedback
+#define RADIOLIB_LINK_ADR_HEADER_INDEX                          (0x0F)  //  3     0   rate index the packet was sent at
+
+// feedback packet, sent by the receiver in reply to a packet that requested it
+#define RADIOLIB_LINK_ADR_FEEDBACK_MAGIC                        (0xAD)
+#define RADIOLIB_LINK_ADR_FEEDBACK_LEN                          (2)     //  magic, new rate index
+
+// maximum number of rates in the ladder, limited by the header index field
+#define RADIOLIB_LINK_ADR_MAX_RATES                             (16)
+
+/*!
+  \class LinkAdrClient
+  \brief Point-to-point adaptive data rate for %LoRa links. Both ends share a ladder of data rates ordered from
+  the most robust to the fastest. The receiver tracks the SNR of received packets and recommends a rate,
+  which it sends back as feedback, after which both ends switch with setIndex. If feedback is lost,
+  both ends are expected to fall back to the first (most robust) rate.
+*/
+class LinkAdrClient {
+  public:
+    /*!
+      \brief Default constructor.
+      \param phy Pointer to the wireless module providing PhysicalLayer communication.
+    */
+    explicit LinkAdrClient(PhysicalLayer* phy);
+
+    /*!
+      \brief Initialization method. Checks every rate of the ladder and switches to the first one.
+      \param rates Data rate ladder, most robust rate first. Must stay valid while the client is used.
+      NULL to use the default ladder from SF12/62.5 kHz to SF7/250 kHz.
+      \param numRates Number of rates in the ladder.
+      \param margin SNR margin to keep above the demodulation floor in dB.
+      \returns \ref status_codes
+    */
+    int16_t begin(const DataRate_t* rates = NULL, uint8_t numRates = 0, float margin = RADIOLIB_LINK_ADR_MARGIN_DB);
+
+    /*!
+      \brief Switches the radio to a rate from the ladder and restarts SNR tracking.
+      \param index Index of the rate in the ladder.
+      \returns \ref status_codes
+    */
+    int16_t setIndex(uint8_t index);
+
+    /*!
+      \brief Gets the index of the current rate.
+      \returns Current rate index.
+    */
+    uint8_t getIndex() const;
+
+    /*!
+      \brief Switches back to the most robust rate, to be used when the link was lost.
+      \returns \ref status_codes
+    */
+    int16_t fallback();
+
+    /*!
+      \brief Feeds the SNR of a packet received at the current rate and recommends the rate to use next.
+      A slower rate is recommended as soon as the margin is gone, a faster one only after
+      RADIOLIB_LINK_ADR_HISTORY packets have all had enough margin for it.
+      \param snr SNR of the received packet in dB.
+      \returns Recommended rate index, equal to getIndex if the rate should not change.
+    */
+    uint8_t update(float snr);
+
+    /*!
+      \brief Gets the SNR margin above the demodulation floor and the configured margin, as of the last update.
+      \returns Margin in dB.
+    */
+    float getMargin() const;
+
+    /*!
+      \brief Gets the link header to prepend to a packet sent at the current rate.
+      \param feedback Whether the receiver should reply with feedback.
+      \returns Link header byte.
+    */
+    uint8_t getHeader(bool feedback) const;
+
+    /*!
+      \brief Builds a feedback packet.
+      \param buff Buffer to save the packet to, at least RADIOLIB_LINK_ADR_FEEDBACK_LEN bytes.
+      \param index Rate index both ends should switch to.
+      \returns Length of the feedback packet.
+    */
+    size_t buildFeedback(uint8_t* buff, uint8_t index) const;
+
+    /*!
+      \brief Parses a feedback packet.
+      \param buff Received packet.
+      \param len Length of the received packet.
+      \param index Pointer to save the rate index to switch to.
+      \returns \ref status_codes
+    */
+    int16_t parseFeedback(const uint8_t* buff, size_t len, uint8_t* index) const;
+
+#if !RADIOLIB_GODMODE
+  private:
+#endif
+    PhysicalLayer* phyLayer;
+    const DataRate_t* rates;
+    uint8_t numRates;
+    uint8_t index;
+    float targetMargin;
+
+    float minSnr;
+    uint8_t numSnr;
+    float margin;
+
+    static float getSnrFloor(uint8_t sf);
+    float getStepCost(uint8_t from, uint8_t to) const;
+};
+
+#endif
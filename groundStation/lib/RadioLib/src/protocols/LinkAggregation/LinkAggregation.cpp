@@ -0,0 +1,210 @@
+#include "LinkAggregation.h"
+#include <string.h>
+
+#if !RADIOLIB_EXCLUDE_LINK_AGGREGATION
+
+LinkAggregationClient::LinkAggregationClient(PhysicalLayer* phy) {
+  phyLayer = phy;
+  maxLen = RADIOLIB_LINK_AGGREGATION_MAX_PACKET_LEN;
+  flushDeadline = RADIOLIB_LINK_AGGREGATION_FLUSH_MS;
+  sendCb = NULL;
+  recordCb = NULL;
+  txLen = 0;
+  txFirst = 0;
+  txMsgId = 0;
+  rxLen = 0;
+  rxActive = false;
+  rxMsgId = 0;
+  rxNext = 0;
+  rxCount = 0;
+}
+
+int16_t LinkAggregationClient::begin(size_t maxLen, uint32_t flushDeadline) {
+  // a packet must have room for at least one byte of data in a fragment
+  if((maxLen <= RADIOLIB_LINK_AGGREGATION_FRAGMENT_HEADER_LEN) || (maxLen > RADIOLIB_LINK_AGGREGATION_MAX_PACKET_LEN)) {
+    return(RADIOLIB_ERR_PACKET_TOO_LONG);
+  }
+
+  this->maxLen = maxLen;
+  this->flushDeadline = flushDeadline;
+  this->txLen = 0;
+  this->rxActive = false;
+  return(RADIOLIB_ERR_NONE);
+}
+
+void LinkAggregationClient::setSendCallback(int16_t (*func)(const uint8_t* data, size_t len)) {
+  this->sendCb = func;
+}
+
+void LinkAggregationClient::setRecordCallback(void (*func)(const uint8_t* data, size_t len)) {
+  this->recordCb = func;
+}
+
+int16_t LinkAggregationClient::add(const uint8_t* data, size_t len) {
+  if(len == 0) {
+    return(RADIOLIB_ERR_NONE);
+  }
+  if(len > RADIOLIB_LINK_AGGREGATION_MAX_MESSAGE_LEN) {
+    return(RADIOLIB_ERR_PACKET_TOO_LONG);
+  }
+
+  // records that cannot share a packet go out in fragments, after the records added before them
+  size_t recordLen = RADIOLIB_LINK_AGGREGATION_RECORD_HEADER_LEN + len;
+  if((len > 0xFF) || (1 + recordLen > this->maxLen)) {
+    int16_t state = flush();
+    RADIOLIB_ASSERT(state);
+    return(sendFragments(data, len));
+  }
+
+  // send what we have if the record does not fit
+  int16_t state = RADIOLIB_ERR_NONE;
+  if(this->txLen + recordLen > this->maxLen) {
+    state = flush();
+  }
+
+  if(this->txLen == 0) {
+    this->txBuff[0] = RADIOLIB_LINK_AGGREGATION_TYPE_RECORDS;
+    this->txLen = 1;
+    this->txFirst = this->phyLayer->getMod()->hal->millis();
+  }
+  this->txBuff[this->txLen++] = (uint8_t)len;
+  memcpy(&this->txBuff[this->txLen], data, len);
+  this->txLen += len;
+
+  // no point in waiting if not even the shortest record would fit any more
+  if(this->txLen + RADIOLIB_LINK_AGGREGATION_RECORD_HEADER_LEN + 1 > this->maxLen) {
+    int16_t flushState = flush();
+    if(state == RADIOLIB_ERR_NONE) {
+      state = flushState;
+    }
+  }
+
+  return(state);
+}
+
+int16_t LinkAggregationClient::flush() {
+  if(this->txLen == 0) {
+    return(RADIOLIB_ERR_NONE);
+  }
+
+  // the packet is gone either way, a failed send does not keep it around
+  size_t len = this->txLen;
+  this->txLen = 0;
+  if(this->sendCb == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+  return(this->sendCb(this->txBuff, len));
+}
+
+int16_t LinkAggregationClient::process() {
+  if(this->txLen == 0) {
+    return(RADIOLIB_ERR_NONE);
+  }
+
+  if(this->phyLayer->getMod()->hal->millis() - this->txFirst < this->flushDeadline) {
+    return(RADIOLIB_ERR_NONE);
+  }
+  return(flush());
+}
+
+int16_t LinkAggregationClient::parse(const uint8_t* data, size_t len) {
+  if(len == 0) {
+    return(RADIOLIB_ERR_INVALID_LINK_PACKET);
+  }
+
+  if(data[0] == RADIOLIB_LINK_AGGREGATION_TYPE_FRAGMENT) {
+    return(parseFragment(data, len));
+  }
+
+  if(data[0] != RADIOLIB_LINK_AGGREGATION_TYPE_RECORDS) {
+    return(RADIOLIB_ERR_INVALID_LINK_PACKET);
+  }
+
+  size_t pos = 1;
+  while(pos < len) {
+    size_t recordLen = data[pos];
+    pos += RADIOLIB_LINK_AGGREGATION_RECORD_HEADER_LEN;
+    if(pos + recordLen > len) {
+      return(RADIOLIB_ERR_INVALID_LINK_PACKET);
+    }
+    if(this->recordCb) {
+      this->recordCb(&data[pos], recordLen);
+    }
+    pos += recordLen;
+  }
+
+  return(RADIOLIB_ERR_NONE);
+}
+
+int16_t LinkAggregationClient::sendFragments(const uint8_t* data, size_t len) {
+  if(this->sendCb == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+
+  size_t fragLen = this->maxLen - RADIOLIB_LINK_AGGREGATION_FRAGMENT_HEADER_LEN;
+  size_t count = (len + fragLen - 1) / fragLen;
+  if(count > 0xFF) {
+    return(RADIOLIB_ERR_PACKET_TOO_LONG);
+  }
+
+  this->txMsgId++;
+  for(size_t i = 0; i < count; i++) {
+    size_t offset = i * fragLen;
+    size_t chunk = RADIOLIB_MIN(fragLen, len - offset);
+    this->txBuff[0] = RADIOLIB_LINK_AGGREGATION_TYPE_FRAGMENT;
+    this->txBuff[1] = this->txMsgId;
+    this->txBuff[2] = (uint8_t)i;
+    this->txBuff[3] = (uint8_t)count;
+    memcpy(&this->txBuff[RADIOLIB_LINK_AGGREGATION_FRAGMENT_HEADER_LEN], &data[offset], chunk);
+
+    // the receiver cannot use the record without every fragment, so stop at the first failure
+    int16_t state = this->sendCb(this->txBuff, RADIOLIB_LINK_AGGREGATION_FRAGMENT_HEADER_LEN + chunk);
+    RADIOLIB_ASSERT(state);
+  }
+
+  return(RADIOLIB_ERR_NONE);
+}
+
+int16_t LinkAggregationClient::parseFragment(const uint8_t* data, size_t len) {
+  if(len <= RADIOLIB_LINK_AGGREGATION_FRAGMENT_HEADER_LEN) {
+    return(RADIOLIB_ERR_INVALID_LINK_PACKET);
+  }
+  uint8_t msgId = data[1];
+  uint8_t index = data[2];
+  uint8_t count = data[3];
+
+  // the first fragment starts a new record, discarding any incomplete one
+  if(index == 0) {
+    this->rxActive = true;
+    this->rxMsgId = msgId;
+    this->rxNext = 0;
+    this->rxCount = count;
+    this->rxLen = 0;
+  }
+
+  // anything out of order means a fragment was lost
+  if(!this->rxActive || (msgId != this->rxMsgId) || (index != this->rxNext) || (count != this->rxCount)) {
+    this->rxActive = false;
+    return(RADIOLIB_ERR_INVALID_LINK_PACKET);
+  }
+
+  size_t chunk = len - RADIOLIB_LINK_AGGREGATION_FRAGMENT_HEADER_LEN;
+  if(this->rxLen + chunk > RADIOLIB_LINK_AGGREGATION_MAX_MESSAGE_LEN) {
+    this->rxActive = false;
+    return(RADIOLIB_ERR_PACKET_TOO_LONG);
+  }
+  memcpy(&this->rxBuff[this->rxLen], &data[RADIOLIB_LINK_AGGREGATION_FRAGMENT_HEADER_LEN], chunk);
+  this->rxLen += chunk;
+  this->rxNext++;
+
+  if(this->rxNext == this->rxCount) {
+    this->rxActive = false;
+    if(this->recordCb) {
+      this->recordCb(this->rxBuff, this->rxLen);
+    }
+  }
+
+  return(RADIOLIB_ERR_NONE);
+}
+
+#endif
@@ -0,0 +1,116 @@
+#if !defined(_RADIOLIB_LINK_AGGREGATION_H) && !RADIOLIB_EXCLUDE_LINK_AGGREGATION
+#define _RADIOLIB_LINK_AGGREGATION_H
+
+#include "../../TypeDef.h"
+#include "../PhysicalLayer/PhysicalLayer.h"
+
+// packet types, first byte of every packet
+#define RADIOLIB_LINK_AGGREGATION_TYPE_RECORDS                  (0x01)  //  type, then length-prefixed records
+#define RADIOLIB_LINK_AGGREGATION_TYPE_FRAGMENT                 (0x02)  //  type, message ID, fragment index, fragment count, data
+
+#define RADIOLIB_LINK_AGGREGATION_RECORD_HEADER_LEN             (1)
+#define RADIOLIB_LINK_AGGREGATION_FRAGMENT_HEADER_LEN           (4)
+
+// largest packet that can be built, the actual limit is set in begin
+#define RADIOLIB_LINK_AGGREGATION_MAX_PACKET_LEN                (255)
+
+// largest record that can be sent in fragments and reassembled
+#define RADIOLIB_LINK_AGGREGATION_MAX_MESSAGE_LEN               (1024)
+
+// default time in ms a record may wait for others to share its packet
+#define RADIOLIB_LINK_AGGREGATION_FLUSH_MS                      (1000)
+
+/*!
+  \class LinkAggregationClient
+  \brief Link layer that packs many small records into one packet to share the %LoRa preamble and header overhead,
+  and splits records too long for a single packet into fragments. Packets are handed to a send callback
+  (e.g. queued in TransmitQueueClient), received packets are passed to parse and records come out of a record callback.
+*/
+class LinkAggregationClient {
+  public:
+    /*!
+      \brief Default constructor.
+      \param phy Pointer to the wireless module providing PhysicalLayer communication.
+    */
+    explicit LinkAggregationClient(PhysicalLayer* phy);
+
+    /*!
+      \brief Initialization method.
+      \param maxLen Maximum length of a packet, at most RADIOLIB_LINK_AGGREGATION_MAX_PACKET_LEN.
+      Reduce it by the length of any header the send callback adds.
+      \param flushDeadline Maximum time in ms a record may wait in a partially filled packet.
+      \returns \ref status_codes
+    */
+    int16_t begin(size_t maxLen = RADIOLIB_LINK_AGGREGATION_MAX_PACKET_LEN, uint32_t flushDeadline = RADIOLIB_LINK_AGGREGATION_FLUSH_MS);
+
+    /*!
+      \brief Sets the function that sends a complete packet.
+      \param func Pointer to the send function, returns \ref status_codes.
+    */
+    void setSendCallback(int16_t (*func)(const uint8_t* data, size_t len));
+
+    /*!
+      \brief Sets the function that is called with every record extracted by parse.
+      \param func Pointer to the record function.
+    */
+    void setRecordCallback(void (*func)(const uint8_t* data, size_t len));
+
+    /*!
+      \brief Adds a record to the packet being built. Sends the packet first if the record does not fit,
+      records longer than a packet are sent straight away in fragments.
+      \param data Record to send.
+      \param len Length of the record, at most RADIOLIB_LINK_AGGREGATION_MAX_MESSAGE_LEN.
+      \returns \ref status_codes of the send callback, if it was called.
+    */
+    int16_t add(const uint8_t* data, size_t len);
+
+    /*!
+      \brief Sends the packet being built, if it contains any records.
+      \returns \ref status_codes
+    */
+    int16_t flush();
+
+    /*!
+      \brief Sends the packet being built once its oldest record has waited for the flush deadline.
+      Call this regularly from the main loop.
+      \returns \ref status_codes
+    */
+    int16_t process();
+
+    /*!
+      \brief Extracts the records from a received packet and passes them to the record callback.
+      Fragments are collected until the whole record has been received, a missing fragment discards the record.
+      \param data Received packet.
+      \param len Length of the received packet.
+      \returns \ref status_codes
+    */
+    int16_t parse(const uint8_t* data, size_t len);
+
+#if !RADIOLIB_GODMODE
+  private:
+#endif
+    PhysicalLayer* phyLayer;
+    size_t maxLen;
+    uint32_t flushDeadline;
+    int16_t (*sendCb)(const uint8_t* data, size_t len);
+    void (*recordCb)(const uint8_t* data, size_t len);
+
+    // packet being built
+    uint8_t txBuff[RADIOLIB_LINK_AGGREGATION_MAX_PACKET_LEN];
+    size_t txLen;
+    uint32_t txFirst;
+    uint8_t txMsgId;
+
+    // record being reassembled
+    uint8_t rxBuff[RADIOLIB_LINK_AGGREGATION_MAX_MESSAGE_LEN];
+    size_t rxLen;
+    bool rxActive;
+    uint8_t rxMsgId;
+    uint8_t rxNext;
+    uint8_t rxCount;
+
+    int16_t sendFragments(const uint8_t* data, size_t len);
+    int16_t parseFragment(const uint8_t* data, size_t len);
+};
+
+#endif
@@ -47,6 +47,7 @@ void LoRaWANNode::setCSMA(uint8_t backoffMax, uint8_t difsSlots, bool enableCSMA
 void LoRaWANNode::wipe() {
   memset(this->bufferNonces, 0, RADIOLIB_LORAWAN_NONCES_BUF_SIZE);
   memset(this->bufferSession, 0, RADIOLIB_LORAWAN_SESSION_BUF_SIZE);
+  RadioLibAES128Instance.clearKeys();
 }
 
 uint8_t* LoRaWANNode::getBufferNonces() {
@@ -981,8 +982,37 @@ int16_t LoRaWANNode::uplink(uint8_t* data, size_t len, uint8_t port, bool isConf
   }
 
   // build the uplink message
-  // the first 16 bytes are reserved for MIC calculation blocks
+  // the first 16 bytes are not sent and stay unused: the MIC blocks go straight into the CMAC below,
+  // they are kept so that the frame offsets are the same as for downlinks, which hold their MIC block there
   size_t uplinkMsgLen = RADIOLIB_LORAWAN_FRAME_LEN(len, foptsLen);
+
+  // create blocks for MIC calculation
+  uint8_t block0[RADIOLIB_AES128_BLOCK_SIZE] = { 0 };
+  block0[RADIOLIB_LORAWAN_BLOCK_MAGIC_POS] = RADIOLIB_LORAWAN_MIC_BLOCK_MAGIC;
+  block0[RADIOLIB_LORAWAN_BLOCK_DIR_POS] = RADIOLIB_LORAWAN_CHANNEL_DIR_UPLINK;
+  LoRaWANNode::hton<uint32_t>(&block0[RADIOLIB_LORAWAN_BLOCK_DEV_ADDR_POS], this->devAddr);
+  LoRaWANNode::hton<uint32_t>(&block0[RADIOLIB_LORAWAN_BLOCK_FCNT_POS], this->fcntUp);
+  block0[RADIOLIB_LORAWAN_MIC_BLOCK_LEN_POS] = uplinkMsgLen - RADIOLIB_AES128_BLOCK_SIZE - sizeof(uint32_t);
+
+  uint8_t block1[RADIOLIB_AES128_BLOCK_SIZE] = { 0 };
+  memcpy(block1, block0, RADIOLIB_AES128_BLOCK_SIZE);
+  if(this->confFcntDown != RADIOLIB_LORAWAN_FCNT_NONE) {
+    LoRaWANNode::hton<uint16_t>(&block1[RADIOLIB_LORAWAN_BLOCK_CONF_FCNT_POS], (uint16_t)this->confFcntDown);
+  }
+  block1[RADIOLIB_LORAWAN_MIC_DATA_RATE_POS] = this->dataRates[RADIOLIB_LORAWAN_CHANNEL_DIR_UPLINK];
+  block1[RADIOLIB_LORAWAN_MIC_CH_INDEX_POS] = this->currentChannels[RADIOLIB_LORAWAN_CHANNEL_DIR_UPLINK].idx;
+
+  // the MICs are calculated as the frame is built, so the frame is only traversed once
+  // LoRaWAN 1.0 only uses the first one, calculated with fNwkSIntKey = sNwkSIntKey = NwkSKey
+  RadioLibCMAC_t mic[2];
+  uint8_t numMic = (this->rev == 1) ? 2 : 1;
+  RadioLibAES128Instance.beginCMAC(&mic[0], this->fNwkSIntKey);
+  RadioLibAES128Instance.updateCMAC(&mic[0], block0, RADIOLIB_AES128_BLOCK_SIZE);
+  if(this->rev == 1) {
+    RadioLibAES128Instance.beginCMAC(&mic[1], this->sNwkSIntKey);
+    RadioLibAES128Instance.updateCMAC(&mic[1], block1, RADIOLIB_AES128_BLOCK_SIZE);
+  }
+
   #if RADIOLIB_STATIC_ONLY
   uint8_t uplinkMsg[RADIOLIB_STATIC_ARRAY_SIZE];
   #else
@@ -999,8 +1029,7 @@ int16_t LoRaWANNode::uplink(uint8_t* data, size_t len, uint8_t port, bool isConf
   uplinkMsg[RADIOLIB_LORAWAN_FHDR_LEN_START_OFFS] |= RADIOLIB_LORAWAN_MHDR_MAJOR_R1;
   LoRaWANNode::hton<uint32_t>(&uplinkMsg[RADIOLIB_LORAWAN_FHDR_DEV_ADDR_POS], this->devAddr);
 
-  // length of fopts will be added later
-  uplinkMsg[RADIOLIB_LORAWAN_FHDR_FCTRL_POS] = 0x00;
+  uplinkMsg[RADIOLIB_LORAWAN_FHDR_FCTRL_POS] = foptsLen;
   if(this->adrEnabled) {
     uplinkMsg[RADIOLIB_LORAWAN_FHDR_FCTRL_POS] |= RADIOLIB_LORAWAN_FCTRL_ADR_ENABLED;
     if(adrAckReq) {
@@ -1016,6 +1045,9 @@ int16_t LoRaWANNode::uplink(uint8_t* data, size_t len, uint8_t port, bool isConf
   }
 
   LoRaWANNode::hton<uint16_t>(&uplinkMsg[RADIOLIB_LORAWAN_FHDR_FCNT_POS], (uint16_t)this->fcntUp);
+  for(uint8_t i = 0; i < numMic; i++) {
+    RadioLibAES128Instance.updateCMAC(&mic[i], &uplinkMsg[RADIOLIB_LORAWAN_FHDR_LEN_START_OFFS], RADIOLIB_LORAWAN_FHDR_FOPTS_POS - RADIOLIB_LORAWAN_FHDR_LEN_START_OFFS);
+  }
 
   // check if we have some MAC commands to append
   if(foptsLen > 0) {
@@ -1046,16 +1078,16 @@ int16_t LoRaWANNode::uplink(uint8_t* data, size_t len, uint8_t port, bool isConf
       }
     }
 
-    uplinkMsgLen = RADIOLIB_LORAWAN_FRAME_LEN(len, foptsLen);
-    uplinkMsg[RADIOLIB_LORAWAN_FHDR_FCTRL_POS] |= foptsLen;
-
     // encrypt it
-    processAES(foptsBuff, foptsLen, this->nwkSEncKey, &uplinkMsg[RADIOLIB_LORAWAN_FHDR_FOPTS_POS], this->fcntUp, RADIOLIB_LORAWAN_CHANNEL_DIR_UPLINK, 0x01, true);
+    processAES(foptsBuff, foptsLen, this->nwkSEncKey, &uplinkMsg[RADIOLIB_LORAWAN_FHDR_FOPTS_POS], this->fcntUp, RADIOLIB_LORAWAN_CHANNEL_DIR_UPLINK, 0x01, true, mic, numMic);
     
   }
 
   // set the port
   uplinkMsg[RADIOLIB_LORAWAN_FHDR_FPORT_POS(foptsLen)] = port;
+  for(uint8_t i = 0; i < numMic; i++) {
+    RadioLibAES128Instance.updateCMAC(&mic[i], &port, 1);
+  }
 
   // select encryption key based on the target port
   uint8_t* encKey = this->appSKey;
@@ -1064,38 +1096,20 @@ int16_t LoRaWANNode::uplink(uint8_t* data, size_t len, uint8_t port, bool isConf
   }
 
   // encrypt the frame payload
-  processAES(data, len, encKey, &uplinkMsg[RADIOLIB_LORAWAN_FRAME_PAYLOAD_POS(foptsLen)], this->fcntUp, RADIOLIB_LORAWAN_CHANNEL_DIR_UPLINK, 0x00, true);
+  processAES(data, len, encKey, &uplinkMsg[RADIOLIB_LORAWAN_FRAME_PAYLOAD_POS(foptsLen)], this->fcntUp, RADIOLIB_LORAWAN_CHANNEL_DIR_UPLINK, 0x00, true, mic, numMic);
 
-  // create blocks for MIC calculation
-  uint8_t block0[RADIOLIB_AES128_BLOCK_SIZE] = { 0 };
-  block0[RADIOLIB_LORAWAN_BLOCK_MAGIC_POS] = RADIOLIB_LORAWAN_MIC_BLOCK_MAGIC;
-  block0[RADIOLIB_LORAWAN_BLOCK_DIR_POS] = RADIOLIB_LORAWAN_CHANNEL_DIR_UPLINK;
-  LoRaWANNode::hton<uint32_t>(&block0[RADIOLIB_LORAWAN_BLOCK_DEV_ADDR_POS], this->devAddr);
-  LoRaWANNode::hton<uint32_t>(&block0[RADIOLIB_LORAWAN_BLOCK_FCNT_POS], this->fcntUp);
-  block0[RADIOLIB_LORAWAN_MIC_BLOCK_LEN_POS] = uplinkMsgLen - RADIOLIB_AES128_BLOCK_SIZE - sizeof(uint32_t);
-
-  uint8_t block1[RADIOLIB_AES128_BLOCK_SIZE] = { 0 };
-  memcpy(block1, block0, RADIOLIB_AES128_BLOCK_SIZE);
-  if(this->confFcntDown != RADIOLIB_LORAWAN_FCNT_NONE) {
-    LoRaWANNode::hton<uint16_t>(&block1[RADIOLIB_LORAWAN_BLOCK_CONF_FCNT_POS], (uint16_t)this->confFcntDown);
-  }
-  block1[RADIOLIB_LORAWAN_MIC_DATA_RATE_POS] = this->dataRates[RADIOLIB_LORAWAN_CHANNEL_DIR_UPLINK];
-  block1[RADIOLIB_LORAWAN_MIC_CH_INDEX_POS] = this->currentChannels[RADIOLIB_LORAWAN_CHANNEL_DIR_UPLINK].idx;
-  
   RADIOLIB_DEBUG_PROTOCOL_PRINTLN("Uplink (FcntUp = %d) decoded:", this->fcntUp);
 
   RADIOLIB_DEBUG_PROTOCOL_HEXDUMP(uplinkMsg, uplinkMsgLen);
 
-  // calculate authentication codes
-  memcpy(uplinkMsg, block1, RADIOLIB_AES128_BLOCK_SIZE);
-  uint32_t micS = this->generateMIC(uplinkMsg, uplinkMsgLen - sizeof(uint32_t), this->sNwkSIntKey);
-  memcpy(uplinkMsg, block0, RADIOLIB_AES128_BLOCK_SIZE);
-  uint32_t micF = this->generateMIC(uplinkMsg, uplinkMsgLen - sizeof(uint32_t), this->fNwkSIntKey);
+  // finish authentication codes
+  uint32_t micF = this->finishMIC(&mic[0]);
 
   // check LoRaWAN revision
   if(this->rev == 1) {
-    uint32_t mic = ((uint32_t)(micF & 0x0000FF00) << 16) | ((uint32_t)(micF & 0x0000000FF) << 16) | ((uint32_t)(micS & 0x0000FF00) >> 0) | ((uint32_t)(micS & 0x0000000FF) >> 0);
-    LoRaWANNode::hton<uint32_t>(&uplinkMsg[uplinkMsgLen - sizeof(uint32_t)], mic);
+    uint32_t micS = this->finishMIC(&mic[1]);
+    uint32_t micFull = ((uint32_t)(micF & 0x0000FF00) << 16) | ((uint32_t)(micF & 0x0000000FF) << 16) | ((uint32_t)(micS & 0x0000FF00) >> 0) | ((uint32_t)(micS & 0x0000000FF) >> 0);
+    LoRaWANNode::hton<uint32_t>(&uplinkMsg[uplinkMsgLen - sizeof(uint32_t)], micFull);
   } else {
     LoRaWANNode::hton<uint32_t>(&uplinkMsg[uplinkMsgLen - sizeof(uint32_t)], micF);
   }
@@ -1660,9 +1674,15 @@ uint32_t LoRaWANNode::generateMIC(uint8_t* msg, size_t len, uint8_t* key) {
     return(0);
   }
 
-  RadioLibAES128Instance.init(key);
+  RadioLibCMAC_t ctx;
+  RadioLibAES128Instance.beginCMAC(&ctx, key);
+  RadioLibAES128Instance.updateCMAC(&ctx, msg, len);
+  return(finishMIC(&ctx));
+}
+
+uint32_t LoRaWANNode::finishMIC(RadioLibCMAC_t* ctx) {
   uint8_t cmac[RADIOLIB_AES128_BLOCK_SIZE];
-  RadioLibAES128Instance.generateCMAC(msg, len, cmac);
+  RadioLibAES128Instance.finishCMAC(ctx, cmac);
   return(((uint32_t)cmac[0]) | ((uint32_t)cmac[1] << 8) | ((uint32_t)cmac[2] << 16) | ((uint32_t)cmac[3]) << 24);
 }
 
@@ -2842,7 +2862,7 @@ bool LoRaWANNode::performCAD() {
     return false; // Channel is free
 }
 
-void LoRaWANNode::processAES(uint8_t* in, size_t len, uint8_t* key, uint8_t* out, uint32_t fcnt, uint8_t dir, uint8_t ctrId, bool counter) {
+void LoRaWANNode::processAES(uint8_t* in, size_t len, uint8_t* key, uint8_t* out, uint32_t fcnt, uint8_t dir, uint8_t ctrId, bool counter, RadioLibCMAC_t* mic, uint8_t numMic) {
   // figure out how many encryption blocks are there
   size_t numBlocks = len/RADIOLIB_AES128_BLOCK_SIZE;
   if(len % RADIOLIB_AES128_BLOCK_SIZE) {
@@ -2860,15 +2880,19 @@ void LoRaWANNode::processAES(uint8_t* in, size_t len, uint8_t* key, uint8_t* out
 
   // now encrypt the input
   // on downlink frames, this has a decryption effect because server actually "decrypts" the plaintext
+  RadioLibAES128Instance.init(key);
   size_t remLen = len;
   for(size_t i = 0; i < numBlocks; i++) {
+    // the MICs switch to their own keys
+    if(numMic > 0) {
+      RadioLibAES128Instance.init(key);
+    }
 
     if(counter) {
       encBlock[RADIOLIB_LORAWAN_ENC_BLOCK_COUNTER_POS] = i + 1;
     }
 
     // encrypt the buffer
-    RadioLibAES128Instance.init(key);
     RadioLibAES128Instance.encryptECB(encBlock, RADIOLIB_AES128_BLOCK_SIZE, encBuffer);
 
     // now xor the buffer with the input
@@ -2879,6 +2903,9 @@ void LoRaWANNode::processAES(uint8_t* in, size_t len, uint8_t* key, uint8_t* out
     for(uint8_t j = 0; j < xorLen; j++) {
       out[i*RADIOLIB_AES128_BLOCK_SIZE + j] = in[i*RADIOLIB_AES128_BLOCK_SIZE + j] ^ encBuffer[j];
     }
+    for(uint8_t j = 0; j < numMic; j++) {
+      RadioLibAES128Instance.updateCMAC(&mic[j], &out[i*RADIOLIB_AES128_BLOCK_SIZE], xorLen);
+    }
     remLen -= xorLen;
   }
 }
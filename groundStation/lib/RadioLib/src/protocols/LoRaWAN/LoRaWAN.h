@@ -958,6 +958,9 @@ class LoRaWANNode {
     // method to generate message integrity code
     uint32_t generateMIC(uint8_t* msg, size_t len, uint8_t* key);
 
+    // method to finish a message integrity code calculated in parts
+    uint32_t finishMIC(RadioLibCMAC_t* ctx);
+
     // method to verify message integrity code
     // it assumes that the MIC is the last 4 bytes of the message
     bool verifyMIC(uint8_t* msg, size_t len, uint8_t* key);
@@ -1024,7 +1027,8 @@ class LoRaWANNode {
     bool performCAD();
 
     // function to encrypt and decrypt payloads
-    void processAES(uint8_t* in, size_t len, uint8_t* key, uint8_t* out, uint32_t fcnt, uint8_t dir, uint8_t ctrId, bool counter);
+    // the output is also added to numMic MICs in progress, so they need no separate pass over it
+    void processAES(uint8_t* in, size_t len, uint8_t* key, uint8_t* out, uint32_t fcnt, uint8_t dir, uint8_t ctrId, bool counter, RadioLibCMAC_t* mic = NULL, uint8_t numMic = 0);
 
     // 16-bit checksum method that takes a uint8_t array of even length and calculates the checksum
     static uint16_t checkSum16(uint8_t *key, uint16_t keyLen);
@@ -354,9 +354,15 @@ int16_t PagerClient::readData(uint8_t* data, size_t* len, uint32_t* addr) {
   uint8_t framePos = 0;
   uint8_t symbolLength = 0;
   while(!match && phyLayer->available()) {
-    uint32_t cw = read();
+    bool valid = true;
+    uint32_t cw = read(&valid);
     framePos++;
 
+    // a damaged word could match someone else's address, so it cannot be trusted
+    if(!valid) {
+      continue;
+    }
+
     // check if it's the idle code word
     if(cw == RADIOLIB_PAGER_IDLE_CODE_WORD) {
       continue;
@@ -540,7 +546,7 @@ void PagerClient::write(uint32_t codeWord) {
 }
 
 #if !RADIOLIB_EXCLUDE_DIRECT_RECEIVE
-uint32_t PagerClient::read() {
+uint32_t PagerClient::read(bool* valid) {
   uint32_t codeWord = 0;
   codeWord |= (uint32_t)phyLayer->read() << 24;
   codeWord |= (uint32_t)phyLayer->read() << 16;
@@ -555,7 +561,12 @@ uint32_t PagerClient::read() {
   }
 
   RADIOLIB_DEBUG_PROTOCOL_PRINTLN("R\t%lX", codeWord);
-  // TODO BCH error correction here
+
+  // correct up to two bit errors, words beyond repair are passed on as received
+  int16_t state = RadioLibBCHInstance.decode(&codeWord);
+  if(valid) {
+    *valid = (state == RADIOLIB_ERR_NONE);
+  }
   return(codeWord);
 }
 #endif
@@ -196,7 +196,7 @@ class PagerClient {
     bool addressMatched(uint32_t addr);
 
 #if !RADIOLIB_EXCLUDE_DIRECT_RECEIVE
-    uint32_t read();
+    uint32_t read(bool* valid = NULL);
 #endif
 
     uint8_t encodeBCD(char c);
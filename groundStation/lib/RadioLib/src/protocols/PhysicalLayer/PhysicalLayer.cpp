@@ -115,6 +115,22 @@ int16_t PhysicalLayer::receive(uint8_t* data, size_t len) {
   return(RADIOLIB_ERR_UNSUPPORTED);
 }
 
+int16_t PhysicalLayer::receive(uint8_t* data, size_t maxLen, size_t* len) {
+  // zero length would make the module read the whole packet
+  if((data == NULL) || (maxLen == 0)) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+
+  int16_t state = receive(data, maxLen);
+  if(len != NULL) {
+    *len = 0;
+    if((state == RADIOLIB_ERR_NONE) || (state == RADIOLIB_ERR_CRC_MISMATCH) || (state == RADIOLIB_ERR_LORA_HEADER_DAMAGED)) {
+      *len = RADIOLIB_MIN(getPacketLength(false), maxLen);
+    }
+  }
+  return(state);
+}
+
 int16_t PhysicalLayer::sleep() {
   return(RADIOLIB_ERR_UNSUPPORTED);
 }
@@ -212,6 +228,38 @@ int16_t PhysicalLayer::readData(uint8_t* data, size_t len) {
   return(RADIOLIB_ERR_UNSUPPORTED);
 }
 
+int16_t PhysicalLayer::readData(uint8_t* data, size_t maxLen, size_t* len) {
+  // zero length would make the module read the whole packet
+  if((data == NULL) || (maxLen == 0)) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+
+  // length can only be zero here for an empty packet, in which case reading the whole packet is fine
+  size_t length = RADIOLIB_MIN(getPacketLength(), maxLen);
+  int16_t state = readData(data, length);
+
+  if(len != NULL) {
+    *len = length;
+  }
+  return(state);
+}
+
+int16_t PhysicalLayer::readData(RadioLibPacketQueue& queue) {
+  RadioLibPacket_t* packet = queue.reserve();
+  if(!packet) {
+    // read a single byte, the rest is dumped by the module and it is ready for the next packet
+    uint8_t dummy = 0;
+    readData(&dummy, 1);
+    return(RADIOLIB_ERR_QUEUE_FULL);
+  }
+
+  packet->state = readData(packet->data, RADIOLIB_PACKET_QUEUE_MAX_LEN, &packet->len);
+  getPacketInfo(&packet->info);
+  queue.commit();
+
+  return(packet->state);
+}
+
 int16_t PhysicalLayer::transmitDirect(uint32_t frf) {
   (void)frf;
   return(RADIOLIB_ERR_UNSUPPORTED);
@@ -294,6 +342,17 @@ float PhysicalLayer::getSNR() {
   return(RADIOLIB_ERR_UNSUPPORTED);
 }
 
+int16_t PhysicalLayer::getPacketInfo(RadioLibPacketInfo_t* info) {
+  if(info == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+  info->timestamp = this->getMod()->irqTimestamp;
+  info->rssi = getRSSI();
+  info->snr = getSNR();
+  info->freqError = 0;
+  return(RADIOLIB_ERR_NONE);
+}
+
 uint32_t PhysicalLayer::getTimeOnAir(size_t len) {
   (void)len;
   return(0);
@@ -3,6 +3,7 @@
 
 #include "../../TypeDef.h"
 #include "../../Module.h"
+#include "../../utils/PacketQueue.h"
 
 /*!
   \struct LoRaRate_t
@@ -154,6 +155,15 @@ class PhysicalLayer {
     */
     virtual int16_t receive(uint8_t* data, size_t len);
 
+    /*!
+      \brief Binary receive method into a caller-owned buffer, without any temporary buffer or dynamic allocation.
+      \param data Pointer to array to save the received binary data.
+      \param maxLen Size of the array. Longer packets are truncated to this length.
+      \param len Pointer to save the number of bytes written to data, can be NULL.
+      \returns \ref status_codes
+    */
+    int16_t receive(uint8_t* data, size_t maxLen, size_t* len);
+
     #if defined(RADIOLIB_BUILD_ARDUINO)
     /*!
       \brief Interrupt-driven Arduino String transmit method. Unlike the standard transmit method, this one is non-blocking.
@@ -209,6 +219,25 @@ class PhysicalLayer {
     */
     virtual int16_t readData(uint8_t* data, size_t len);
 
+    /*!
+      \brief Reads data that was received after calling startReceive method into a caller-owned buffer,
+      without any temporary buffer or dynamic allocation.
+      \param data Pointer to array to save the received binary data.
+      \param maxLen Size of the array. Longer packets are truncated to this length, the rest is discarded.
+      \param len Pointer to save the number of bytes written to data, can be NULL.
+      \returns \ref status_codes
+    */
+    int16_t readData(uint8_t* data, size_t maxLen, size_t* len);
+
+    /*!
+      \brief Reads the received packet into the next free slot of a packet queue, together with its metadata (see getPacketInfo).
+      Intended to be called from the packet received callback, on platforms where SPI may be used in interrupt context,
+      or as soon as possible after it otherwise. If the queue is full, the packet is still read out of the module and discarded.
+      \param queue Queue to add the packet to.
+      \returns \ref status_codes, RADIOLIB_ERR_QUEUE_FULL if the packet was discarded.
+    */
+    int16_t readData(RadioLibPacketQueue& queue);
+
     /*!
       \brief Enables direct transmission mode on pins DIO1 (clock) and DIO2 (data). Must be implemented in module class.
       While in direct mode, the module will not be able to transmit or receive packets. Can only be activated in FSK mode.
@@ -330,6 +359,15 @@ class PhysicalLayer {
     */
     virtual float getSNR();
 
+    /*!
+      \brief Gets the metadata of the last packet: the timestamp of the interrupt that signalled RX or TX done,
+      and for received packets RSSI, SNR and frequency error. The timestamp is only recorded when the interrupt action
+      was set through the module (e.g. setPacketReceivedAction), or by the blocking transmit/receive methods.
+      \param info Pointer to structure to save the metadata to.
+      \returns \ref status_codes
+    */
+    virtual int16_t getPacketInfo(RadioLibPacketInfo_t* info);
+
     /*!
       \brief Get expected time-on-air for a given size of payload
       \param len Payload length in bytes.
@@ -546,6 +584,8 @@ class PhysicalLayer {
     friend class BellClient;
     friend class FT8Client;
     friend class LoRaWANNode;
+    friend class TransmitQueueClient;
+    friend class LinkAggregationClient;
 };
 
 #endif
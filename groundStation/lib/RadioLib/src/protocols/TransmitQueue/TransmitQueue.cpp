@@ -0,0 +1,289 @@
+#include "TransmitQueue.h"
+#include <string.h>
+
+#if !RADIOLIB_EXCLUDE_TRANSMIT_QUEUE
+
+TransmitQueueClient::TransmitQueueClient(PhysicalLayer* phy) {
+  phyLayer = phy;
+  packetSentCb = NULL;
+  budget = NULL;
+  channel = 0;
+  order = 0;
+  dropped = 0;
+  txDone = false;
+  busy = false;
+  paused = false;
+  current = -1;
+  txStart = 0;
+  txTimeout = 0;
+  txStartMs = 0;
+  txAirtime = 0;
+  holding = false;
+  holdUntil = 0;
+  for(uint8_t i = 0; i < RADIOLIB_PACKET_QUEUE_SIZE; i++) {
+    entries[i].used = false;
+  }
+}
+
+void TransmitQueueClient::setPacketSentCallback(void (*func)(const RadioLibPacket_t* packet)) {
+  this->packetSentCb = func;
+}
+
+void TransmitQueueClient::setAirtimeBudget(RadioLibAirtimeBudget* budget, uint8_t channel) {
+  this->budget = budget;
+  this->channel = channel;
+  this->holding = false;
+}
+
+int16_t TransmitQueueClient::send(const uint8_t* data, size_t len, uint8_t priority, uint32_t deadline) {
+  if(len > RADIOLIB_PACKET_QUEUE_MAX_LEN) {
+    return(RADIOLIB_ERR_PACKET_TOO_LONG);
+  }
+
+  uint32_t now = this->phyLayer->getMod()->hal->millis();
+  TransmitQueueEntry_t entry;
+  entry.priority = priority;
+  entry.hasDeadline = (deadline > 0);
+  entry.deadline = now + deadline;
+  entry.order = this->order;
+
+  // find a free slot, or the packet that would be sent last, stale packets go first
+  dropExpired(now);
+  int8_t slot = -1;
+  for(int8_t i = 0; i < RADIOLIB_PACKET_QUEUE_SIZE; i++) {
+    if(!this->entries[i].used) {
+      slot = i;
+      break;
+    }
+    if((i != this->current) && ((slot < 0) || isBefore(this->entries[slot], this->entries[i]))) {
+      slot = i;
+    }
+  }
+
+  // the queue is full, drop whichever of the two packets would be sent later
+  if((slot < 0) || this->entries[slot].used) {
+    if((slot < 0) || !isBefore(entry, this->entries[slot])) {
+      this->dropped++;
+      return(RADIOLIB_ERR_QUEUE_FULL);
+    }
+    finishEntry(slot, RADIOLIB_ERR_QUEUE_FULL);
+  }
+
+  TransmitQueueEntry_t* dst = &this->entries[slot];
+  memcpy(dst->packet.data, data, len);
+  dst->packet.len = len;
+  dst->packet.state = RADIOLIB_ERR_NONE;
+  memset(&dst->packet.info, 0, sizeof(dst->packet.info));
+  dst->deadline = entry.deadline;
+  dst->order = entry.order;
+  dst->priority = entry.priority;
+  dst->hasDeadline = entry.hasDeadline;
+  dst->used = true;
+  this->order++;
+
+  // if the radio is idle, there is nothing to wait for
+  if(!this->busy) {
+    this->holding = false;
+    return(startNext());
+  }
+  return(RADIOLIB_ERR_NONE);
+}
+
+void TransmitQueueClient::setFlag() {
+  this->txDone = true;
+}
+
+int16_t TransmitQueueClient::process() {
+  Module* mod = this->phyLayer->getMod();
+  if(!this->busy) {
+    if(this->holding && ((int32_t)(mod->hal->millis() - this->holdUntil) < 0)) {
+      return(RADIOLIB_ERR_NONE);
+    }
+    return(startNext());
+  }
+
+  // wait for the packet sent interrupt, or for the timeout in case it was missed
+  bool timedOut = false;
+  if(!this->txDone) {
+    if(mod->hal->micros() - this->txStart <= this->txTimeout) {
+      return(RADIOLIB_ERR_NONE);
+    }
+    timedOut = true;
+  }
+
+  // clean up after the packet and report it
+  RadioLibPacket_t* packet = &this->entries[this->current].packet;
+  int16_t state = this->phyLayer->finishTransmit();
+  this->busy = false;
+  packet->info.timestamp = timedOut ? mod->hal->micros() : mod->irqTimestamp;
+  int8_t index = this->current;
+  this->current = -1;
+  finishEntry(index, timedOut ? RADIOLIB_ERR_TX_TIMEOUT : state);
+  RADIOLIB_ASSERT(state);
+
+  return(startNext());
+}
+
+void TransmitQueueClient::pause() {
+  this->paused = true;
+}
+
+int16_t TransmitQueueClient::resume() {
+  this->paused = false;
+  this->holding = false;
+  if(!this->busy) {
+    return(startNext());
+  }
+  return(RADIOLIB_ERR_NONE);
+}
+
+bool TransmitQueueClient::isBusy() {
+  return(this->busy);
+}
+
+size_t TransmitQueueClient::available() {
+  size_t num = 0;
+  for(uint8_t i = 0; i < RADIOLIB_PACKET_QUEUE_SIZE; i++) {
+    if(this->entries[i].used) {
+      num++;
+    }
+  }
+  return(num);
+}
+
+uint32_t TransmitQueueClient::getDropped() {
+  return(this->dropped);
+}
+
+uint32_t TransmitQueueClient::getTimeUntilSend() {
+  int8_t next = findNext();
+  if(next < 0) {
+    return(RADIOLIB_AIRTIME_BUDGET_NEVER);
+  }
+
+  // the next packet cannot start before the one on air has finished
+  uint32_t now = this->phyLayer->getMod()->hal->millis();
+  uint32_t wait = 0;
+  if(this->busy) {
+    uint32_t elapsed = now - this->txStartMs;
+    wait = (elapsed < this->txAirtime) ? this->txAirtime - elapsed : 0;
+  }
+
+  if(this->budget == NULL) {
+    return(wait);
+  }
+  uint32_t budgetWait = this->budget->getTimeUntilAvailable(this->channel, now + wait, getAirtime(this->entries[next].packet.len));
+  if(budgetWait == RADIOLIB_AIRTIME_BUDGET_NEVER) {
+    return(budgetWait);
+  }
+  return(wait + budgetWait);
+}
+
+int16_t TransmitQueueClient::startNext() {
+  if(this->paused) {
+    return(RADIOLIB_ERR_NONE);
+  }
+
+  uint32_t now = this->phyLayer->getMod()->hal->millis();
+  dropExpired(now);
+  int8_t next = findNext();
+  if(next < 0) {
+    return(RADIOLIB_ERR_NONE);
+  }
+  RadioLibPacket_t* packet = &this->entries[next].packet;
+
+  // wait until the budget allows the packet, a packet that can never fit would block the queue
+  uint32_t airtime = getAirtime(packet->len);
+  if(this->budget) {
+    uint32_t wait = this->budget->getTimeUntilAvailable(this->channel, now, airtime);
+    if(wait == RADIOLIB_AIRTIME_BUDGET_NEVER) {
+      finishEntry(next, RADIOLIB_ERR_INVALID_DUTY_CYCLE);
+      return(RADIOLIB_ERR_INVALID_DUTY_CYCLE);
+    }
+    if(wait > 0) {
+      this->holding = true;
+      this->holdUntil = now + wait;
+      return(RADIOLIB_ERR_NONE);
+    }
+  }
+  this->holding = false;
+
+  // clear the flag before starting, the interrupt may fire as soon as the transmission begins
+  this->txDone = false;
+  int16_t state = this->phyLayer->startTransmit(packet->data, packet->len);
+  if(state != RADIOLIB_ERR_NONE) {
+    // the packet will not be sent, report it and drop it so it does not block the queue
+    finishEntry(next, state);
+    return(state);
+  }
+
+  // the airtime is accounted when the packet starts, so the budget is never exceeded while it is on air
+  if(this->budget) {
+    this->budget->add(this->channel, now, airtime);
+  }
+
+  // timeout at 150 % of expected time-on-air, same as the blocking transmit
+  this->txStart = this->phyLayer->getMod()->hal->micros();
+  this->txTimeout = (airtime * 1000 * 3) / 2;
+  this->txStartMs = now;
+  this->txAirtime = airtime;
+  this->current = next;
+  this->busy = true;
+  return(state);
+}
+
+int8_t TransmitQueueClient::findNext() const {
+  int8_t next = -1;
+  for(int8_t i = 0; i < RADIOLIB_PACKET_QUEUE_SIZE; i++) {
+    if(!this->entries[i].used || (i == this->current)) {
+      continue;
+    }
+    if((next < 0) || isBefore(this->entries[i], this->entries[next])) {
+      next = i;
+    }
+  }
+  return(next);
+}
+
+bool TransmitQueueClient::isBefore(const TransmitQueueEntry_t& a, const TransmitQueueEntry_t& b) const {
+  if(a.priority != b.priority) {
+    return(a.priority > b.priority);
+  }
+
+  // a packet with a deadline goes before one that can wait indefinitely
+  if(a.hasDeadline != b.hasDeadline) {
+    return(a.hasDeadline);
+  }
+  if(a.hasDeadline && (a.deadline != b.deadline)) {
+    return((int32_t)(a.deadline - b.deadline) < 0);
+  }
+  return((int32_t)(a.order - b.order) < 0);
+}
+
+void TransmitQueueClient::dropExpired(uint32_t now) {
+  for(int8_t i = 0; i < RADIOLIB_PACKET_QUEUE_SIZE; i++) {
+    TransmitQueueEntry_t* entry = &this->entries[i];
+    if(entry->used && entry->hasDeadline && (i != this->current) && ((int32_t)(now - entry->deadline) > 0)) {
+      finishEntry(i, RADIOLIB_ERR_DEADLINE_EXPIRED);
+    }
+  }
+}
+
+void TransmitQueueClient::finishEntry(int8_t index, int16_t state) {
+  TransmitQueueEntry_t* entry = &this->entries[index];
+  if((state == RADIOLIB_ERR_QUEUE_FULL) || (state == RADIOLIB_ERR_DEADLINE_EXPIRED)) {
+    this->dropped++;
+  }
+  entry->packet.state = state;
+  if(this->packetSentCb) {
+    this->packetSentCb(&entry->packet);
+  }
+  entry->used = false;
+}
+
+uint32_t TransmitQueueClient::getAirtime(size_t len) {
+  // rounded up, the budget must not be underestimated
+  return((this->phyLayer->getTimeOnAir(len) + 999) / 1000);
+}
+
+#endif
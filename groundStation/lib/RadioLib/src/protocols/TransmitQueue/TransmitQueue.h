@@ -0,0 +1,163 @@
+#if !defined(_RADIOLIB_TRANSMIT_QUEUE_H) && !RADIOLIB_EXCLUDE_TRANSMIT_QUEUE
+#define _RADIOLIB_TRANSMIT_QUEUE_H
+
+#include "../../TypeDef.h"
+#include "../PhysicalLayer/PhysicalLayer.h"
+#include "../../utils/PacketQueue.h"
+#include "../../utils/AirtimeBudget.h"
+
+/*!
+  \struct TransmitQueueEntry_t
+  \brief A queued packet together with its scheduling parameters.
+*/
+struct TransmitQueueEntry_t {
+  /*! \brief The packet, its state holds the transmission result once it has been sent. */
+  RadioLibPacket_t packet;
+
+  /*! \brief millis() time after which the packet is discarded, if hasDeadline is set. */
+  uint32_t deadline;
+
+  /*! \brief Queueing order, keeps packets of the same priority and deadline first-in first-out. */
+  uint32_t order;
+
+  /*! \brief Packets with higher priority are sent first. */
+  uint8_t priority;
+
+  /*! \brief Whether the packet has a deadline. */
+  bool hasDeadline;
+
+  /*! \brief Whether the slot holds a packet. */
+  bool used;
+};
+
+/*!
+  \class TransmitQueueClient
+  \brief Non-blocking transmit pipeline. Packets are queued by the application and sent back-to-back,
+  the next one is started as soon as the previous one has finished, without waiting for time-on-air.
+
+  Queued packets are sent in order of priority, then deadline, then the order they were queued in.
+  An airtime budget can be set to keep the transmissions within a duty cycle limit, packets then wait
+  until the budget allows them to start. Packets whose deadline passes while waiting are discarded.
+
+  SPI cannot be used from an interrupt on all platforms, so the packet sent interrupt only sets a flag (see setFlag)
+  and the radio is serviced from process(), which has to be called regularly from the main loop.
+*/
+class TransmitQueueClient {
+  public:
+    /*!
+      \brief Default constructor.
+      \param phy Pointer to the wireless module providing PhysicalLayer communication.
+    */
+    explicit TransmitQueueClient(PhysicalLayer* phy);
+
+    /*!
+      \brief Sets the function called after each packet has been sent, has failed or was dropped.
+      The packet state holds the transmission result (RADIOLIB_ERR_QUEUE_FULL or RADIOLIB_ERR_DEADLINE_EXPIRED
+      for dropped packets), and its metadata the timestamp of the packet sent interrupt.
+      \param func Pointer to the completion callback, NULL to disable.
+    */
+    void setPacketSentCallback(void (*func)(const RadioLibPacket_t* packet));
+
+    /*!
+      \brief Sets the airtime budget that limits the transmissions. The budget is shared, so several queues
+      (or the application itself) can account for the same channels.
+      \param budget Pointer to the budget, NULL to send without limits.
+      \param channel Channel index the packets are sent on, call again after changing the frequency.
+    */
+    void setAirtimeBudget(RadioLibAirtimeBudget* budget, uint8_t channel = 0);
+
+    /*!
+      \brief Queues a packet for transmission and starts it straight away if the radio is idle
+      and the airtime budget allows it. Does not block. When the queue is full, the packet replaces
+      the queued packet that would be sent last, if it would be sent before that one.
+      \param data Binary data that will be transmitted.
+      \param len Length of binary data to transmit (in bytes).
+      \param priority Packets with higher priority are sent first.
+      \param deadline Time in ms after which the packet is discarded if it has not been sent, 0 to wait indefinitely.
+      \returns \ref status_codes, RADIOLIB_ERR_QUEUE_FULL if the packet was dropped.
+    */
+    int16_t send(const uint8_t* data, size_t len, uint8_t priority = 0, uint32_t deadline = 0);
+
+    /*!
+      \brief Marks the current packet as sent. Intended to be called from the packet sent interrupt
+      (e.g. the function set by PhysicalLayer::setPacketSentAction), does not access the radio.
+    */
+    void setFlag();
+
+    /*!
+      \brief Finishes the current packet once it has been sent or timed out, reports it through the callback
+      and starts the next queued packet. Call this regularly from the main loop.
+      \returns \ref status_codes of the last radio operation.
+    */
+    int16_t process();
+
+    /*!
+      \brief Stops starting new packets, e.g. to use the radio for reception. The packet on air (if any) is still finished
+      by process(), and packets can still be queued while paused.
+    */
+    void pause();
+
+    /*!
+      \brief Resumes sending queued packets, the next one is started straight away.
+      \returns \ref status_codes
+    */
+    int16_t resume();
+
+    /*!
+      \brief Checks whether a packet is currently on air.
+      \returns True if a transmission is in progress.
+    */
+    bool isBusy();
+
+    /*!
+      \brief Gets the number of packets waiting in the queue, including the one on air.
+      \returns Number of queued packets.
+    */
+    size_t available();
+
+    /*!
+      \brief Gets the number of packets dropped because the queue was full or their deadline passed.
+      \returns Number of dropped packets.
+    */
+    uint32_t getDropped();
+
+    /*!
+      \brief Predicts when the next queued packet can start, after the packet on air and within the airtime budget.
+      \returns Time in ms until the next packet can start, 0 if it can start now,
+      or RADIOLIB_AIRTIME_BUDGET_NEVER if no packet is waiting or it does not fit into the budget.
+    */
+    uint32_t getTimeUntilSend();
+
+#if !RADIOLIB_GODMODE
+  private:
+#endif
+    PhysicalLayer* phyLayer;
+    TransmitQueueEntry_t entries[RADIOLIB_PACKET_QUEUE_SIZE];
+    void (*packetSentCb)(const RadioLibPacket_t* packet);
+    RadioLibAirtimeBudget* budget;
+    uint8_t channel;
+    uint32_t order;
+    uint32_t dropped;
+
+    volatile bool txDone;
+    bool busy;
+    bool paused;
+    int8_t current;
+    uint32_t txStart;
+    uint32_t txTimeout;
+    uint32_t txStartMs;
+    uint32_t txAirtime;
+
+    // the budget is only checked again after this time, unless a packet is queued or the queue is resumed
+    bool holding;
+    uint32_t holdUntil;
+
+    int16_t startNext();
+    int8_t findNext() const;
+    bool isBefore(const TransmitQueueEntry_t& a, const TransmitQueueEntry_t& b) const;
+    void dropExpired(uint32_t now);
+    void finishEntry(int8_t index, int16_t state);
+    uint32_t getAirtime(size_t len);
+};
+
+#endif
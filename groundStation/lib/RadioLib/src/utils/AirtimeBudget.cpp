@@ -0,0 +1,112 @@
+#include "AirtimeBudget.h"
+
+#include <string.h>
+
+#define RADIOLIB_AIRTIME_BUDGET_SLOTS (RADIOLIB_AIRTIME_BUDGET_BUCKETS + 1)
+
+RadioLibAirtimeBudget::RadioLibAirtimeBudget() {
+  bucketLen = 0;
+  memset(limits, 0, sizeof(limits));
+  clear();
+}
+
+int16_t RadioLibAirtimeBudget::begin(uint32_t window, uint32_t limit) {
+  if((window == 0) || (limit == 0)) {
+    return(RADIOLIB_ERR_INVALID_DUTY_CYCLE);
+  }
+
+  // round the bucket length up, the counted buckets must not be shorter than the window
+  this->bucketLen = (window + RADIOLIB_AIRTIME_BUDGET_BUCKETS - 1) / RADIOLIB_AIRTIME_BUDGET_BUCKETS;
+  for(uint8_t i = 0; i < RADIOLIB_AIRTIME_BUDGET_CHANNELS; i++) {
+    this->limits[i] = limit;
+  }
+  clear();
+  return(RADIOLIB_ERR_NONE);
+}
+
+int16_t RadioLibAirtimeBudget::setLimit(uint8_t channel, uint32_t limit) {
+  if(channel >= RADIOLIB_AIRTIME_BUDGET_CHANNELS) {
+    return(RADIOLIB_ERR_INVALID_CHANNEL);
+  }
+  if(limit == 0) {
+    return(RADIOLIB_ERR_INVALID_DUTY_CYCLE);
+  }
+  this->limits[channel] = limit;
+  return(RADIOLIB_ERR_NONE);
+}
+
+void RadioLibAirtimeBudget::add(uint8_t channel, uint32_t now, uint32_t airtime) {
+  if((channel >= RADIOLIB_AIRTIME_BUDGET_CHANNELS) || (this->bucketLen == 0)) {
+    return;
+  }
+
+  // a slot still holding an old bucket is reused for all channels at once
+  uint32_t epoch = now / this->bucketLen;
+  uint8_t slot = epoch % RADIOLIB_AIRTIME_BUDGET_SLOTS;
+  if(this->epochs[slot] != epoch) {
+    this->epochs[slot] = epoch;
+    for(uint8_t i = 0; i < RADIOLIB_AIRTIME_BUDGET_CHANNELS; i++) {
+      this->airtimes[i][slot] = 0;
+    }
+  }
+  this->airtimes[channel][slot] += airtime;
+}
+
+uint32_t RadioLibAirtimeBudget::getUsed(uint8_t channel, uint32_t now) const {
+  if((channel >= RADIOLIB_AIRTIME_BUDGET_CHANNELS) || (this->bucketLen == 0)) {
+    return(0);
+  }
+
+  uint32_t epoch = now / this->bucketLen;
+  uint32_t used = 0;
+  for(uint8_t slot = 0; slot < RADIOLIB_AIRTIME_BUDGET_SLOTS; slot++) {
+    if(epoch - this->epochs[slot] <= RADIOLIB_AIRTIME_BUDGET_BUCKETS) {
+      used += this->airtimes[channel][slot];
+    }
+  }
+  return(used);
+}
+
+uint32_t RadioLibAirtimeBudget::getTimeUntilAvailable(uint8_t channel, uint32_t now, uint32_t airtime) const {
+  if(channel >= RADIOLIB_AIRTIME_BUDGET_CHANNELS) {
+    return(RADIOLIB_AIRTIME_BUDGET_NEVER);
+  }
+
+  // no limit was set
+  if(this->bucketLen == 0) {
+    return(0);
+  }
+
+  uint32_t limit = this->limits[channel];
+  if(airtime > limit) {
+    return(RADIOLIB_AIRTIME_BUDGET_NEVER);
+  }
+  uint32_t used = getUsed(channel, now);
+  if(used + airtime <= limit) {
+    return(0);
+  }
+
+  // walk the buckets from the oldest one until enough airtime has left the window
+  uint32_t epoch = now / this->bucketLen;
+  uint32_t excess = used + airtime - limit;
+  for(uint32_t i = 0; i <= RADIOLIB_AIRTIME_BUDGET_BUCKETS; i++) {
+    uint32_t e = epoch - RADIOLIB_AIRTIME_BUDGET_BUCKETS + i;
+    uint8_t slot = e % RADIOLIB_AIRTIME_BUDGET_SLOTS;
+    if(this->epochs[slot] != e) {
+      continue;
+    }
+    uint32_t expiry = (e + RADIOLIB_AIRTIME_BUDGET_SLOTS) * this->bucketLen;
+    if(this->airtimes[channel][slot] >= excess) {
+      return(expiry - now);
+    }
+    excess -= this->airtimes[channel][slot];
+  }
+
+  // not reached, the airtime fits into an empty window
+  return((epoch + RADIOLIB_AIRTIME_BUDGET_SLOTS) * this->bucketLen - now);
+}
+
+void RadioLibAirtimeBudget::clear() {
+  memset(this->epochs, 0, sizeof(this->epochs));
+  memset(this->airtimes, 0, sizeof(this->airtimes));
+}
@@ -0,0 +1,83 @@
+#if !defined(_RADIOLIB_AIRTIME_BUDGET_H)
+#define _RADIOLIB_AIRTIME_BUDGET_H
+
+#include "../TypeDef.h"
+
+// returned by getTimeUntilAvailable when the airtime can never be used
+#define RADIOLIB_AIRTIME_BUDGET_NEVER                           (0xFFFFFFFF)
+
+/*!
+  \class RadioLibAirtimeBudget
+  \brief Tracks the time-on-air used on each channel over a sliding window, e.g. to stay within
+  the duty cycle limits of a regional band plan (1 % per hour is 36 s per 3600 s).
+
+  The window is split into RADIOLIB_AIRTIME_BUDGET_BUCKETS buckets. Airtime is only forgotten
+  once its whole bucket has left the window, so the budget errs on the safe side by at most one bucket.
+  All times are in milliseconds and are passed in by the caller, so the budget does not depend on the HAL.
+*/
+class RadioLibAirtimeBudget {
+  public:
+    /*!
+      \brief Default constructor.
+    */
+    RadioLibAirtimeBudget();
+
+    /*!
+      \brief Initialization method, clears all recorded airtime.
+      \param window Length of the sliding window in ms.
+      \param limit Airtime allowed in each window on every channel in ms.
+      \returns \ref status_codes
+    */
+    int16_t begin(uint32_t window, uint32_t limit);
+
+    /*!
+      \brief Sets a different limit for one channel, e.g. for a sub-band with a higher duty cycle.
+      \param channel Channel index, less than RADIOLIB_AIRTIME_BUDGET_CHANNELS.
+      \param limit Airtime allowed in each window in ms.
+      \returns \ref status_codes
+    */
+    int16_t setLimit(uint8_t channel, uint32_t limit);
+
+    /*!
+      \brief Records a transmission.
+      \param channel Channel index the transmission was made on.
+      \param now Current time in ms, e.g. the start of the transmission.
+      \param airtime Time-on-air of the transmission in ms.
+    */
+    void add(uint8_t channel, uint32_t now, uint32_t airtime);
+
+    /*!
+      \brief Gets the airtime used on a channel in the window ending now.
+      \param channel Channel index.
+      \param now Current time in ms.
+      \returns Used airtime in ms.
+    */
+    uint32_t getUsed(uint8_t channel, uint32_t now) const;
+
+    /*!
+      \brief Predicts how long a transmission has to wait to stay within the limit.
+      \param channel Channel index.
+      \param now Current time in ms.
+      \param airtime Time-on-air of the transmission in ms.
+      \returns Time in ms until the transmission may start, 0 if it may start now,
+      or RADIOLIB_AIRTIME_BUDGET_NEVER if it is longer than the limit.
+    */
+    uint32_t getTimeUntilAvailable(uint8_t channel, uint32_t now, uint32_t airtime) const;
+
+    /*!
+      \brief Forgets all recorded airtime.
+    */
+    void clear();
+
+#if !RADIOLIB_GODMODE
+  private:
+#endif
+    uint32_t bucketLen;
+    uint32_t limits[RADIOLIB_AIRTIME_BUDGET_CHANNELS];
+
+    // one spare bucket, so that the buckets still counted always cover the whole window
+    uint32_t epochs[RADIOLIB_AIRTIME_BUDGET_BUCKETS + 1];
+    uint32_t airtimes[RADIOLIB_AIRTIME_BUDGET_CHANNELS][RADIOLIB_AIRTIME_BUDGET_BUCKETS + 1];
+};
+
+#endif
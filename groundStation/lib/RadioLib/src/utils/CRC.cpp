@@ -1,11 +1,211 @@
 #include "CRC.h"
 
-RadioLibCRC::RadioLibCRC() {
+#if defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#elif defined(__SSE4_2__)
+#include <nmmintrin.h>
+#endif
+
+#define RADIOLIB_CRC_LOAD_BE(p) (((uint32_t)(p)[0] << 24) | ((uint32_t)(p)[1] << 16) | ((uint32_t)(p)[2] << 8) | (uint32_t)(p)[3])
+#define RADIOLIB_CRC_LOAD_LE(p) (((uint32_t)(p)[3] << 24) | ((uint32_t)(p)[2] << 16) | ((uint32_t)(p)[1] << 8) | (uint32_t)(p)[0])
 
+RadioLibCRC::RadioLibCRC() {
+#if RADIOLIB_CRC_TABLE_SLICES
+  tableValid = false;
+  tableSize = 0;
+  tablePoly = 0;
+  tableRefIn = false;
+#endif
 }
 
 uint32_t RadioLibCRC::checksum(uint8_t* buff, size_t len) {
+  uint32_t mask = (uint32_t)0xFFFFFFFF >> (32 - this->size);
   uint32_t crc = this->init;
+  bool done = false;
+
+  // reflecting every input byte is the same as running the reflected register over the raw input,
+  // which is what both the CPU instructions and the reflected tables do
+  if(this->refIn) {
+    crc = updateHardware(Module::reflect(this->init & mask, this->size), buff, len, &done);
+#if RADIOLIB_CRC_TABLE_SLICES
+    if(!done) {
+      generateTable();
+      crc = updateReflected(crc, buff, len);
+      done = true;
+    }
+#endif
+    if(done) {
+      crc = Module::reflect(crc, this->size);
+    } else {
+      crc = this->init;
+    }
+  }
+#if RADIOLIB_CRC_TABLE_SLICES
+  else {
+    generateTable();
+    crc = update(this->init & mask, buff, len);
+    done = true;
+  }
+#endif
+
+  if(!done) {
+    crc = updateBitwise(crc, buff, len);
+  }
+
+  crc ^= this->out;
+  if(this->refOut) {
+    crc = Module::reflect(crc, this->size);
+  }
+  crc &= mask;
+  return(crc);
+}
+
+#if RADIOLIB_CRC_TABLE_SLICES
+void RadioLibCRC::generateTable() {
+  if(this->tableValid && (this->tableSize == this->size) && (this->tablePoly == this->poly) && (this->tableRefIn == this->refIn)) {
+    return;
+  }
+
+  // the register is kept in a 32-bit window, left-aligned when shifting left and right-aligned when reflected
+  uint32_t mask = (uint32_t)0xFFFFFFFF >> (32 - this->size);
+  if(this->refIn) {
+    uint32_t poly = Module::reflect(this->poly & mask, this->size);
+    for(uint16_t b = 0; b < 256; b++) {
+      uint32_t r = b;
+      for(uint8_t i = 0; i < 8; i++) {
+        r = (r & 1) ? (r >> 1) ^ poly : (r >> 1);
+      }
+      this->table[0][b] = r;
+    }
+  } else {
+    uint32_t poly = (this->poly & mask) << (32 - this->size);
+    for(uint16_t b = 0; b < 256; b++) {
+      uint32_t r = (uint32_t)b << 24;
+      for(uint8_t i = 0; i < 8; i++) {
+        r = (r & 0x80000000) ? (r << 1) ^ poly : (r << 1);
+      }
+      this->table[0][b] = r;
+    }
+  }
+
+  // each further table advances the register by one more byte of zeros
+  for(uint8_t k = 1; k < RADIOLIB_CRC_TABLE_SLICES; k++) {
+    for(uint16_t b = 0; b < 256; b++) {
+      uint32_t r = this->table[k - 1][b];
+      if(this->refIn) {
+        this->table[k][b] = (r >> 8) ^ this->table[0][r & 0xFF];
+      } else {
+        this->table[k][b] = (r << 8) ^ this->table[0][r >> 24];
+      }
+    }
+  }
+
+  this->tableValid = true;
+  this->tableSize = this->size;
+  this->tablePoly = this->poly;
+  this->tableRefIn = this->refIn;
+}
+
+uint32_t RadioLibCRC::update(uint32_t crc, const uint8_t* buff, size_t len) {
+  uint32_t (*t)[256] = this->table;
+  uint32_t w = crc << (32 - this->size);
+
+#if RADIOLIB_CRC_TABLE_SLICES == 8
+  while(len >= 8) {
+    w ^= RADIOLIB_CRC_LOAD_BE(buff);
+    w = t[7][w >> 24] ^ t[6][(w >> 16) & 0xFF] ^ t[5][(w >> 8) & 0xFF] ^ t[4][w & 0xFF] ^
+        t[3][buff[4]] ^ t[2][buff[5]] ^ t[1][buff[6]] ^ t[0][buff[7]];
+    buff += 8;
+    len -= 8;
+  }
+#elif RADIOLIB_CRC_TABLE_SLICES == 4
+  while(len >= 4) {
+    w ^= RADIOLIB_CRC_LOAD_BE(buff);
+    w = t[3][w >> 24] ^ t[2][(w >> 16) & 0xFF] ^ t[1][(w >> 8) & 0xFF] ^ t[0][w & 0xFF];
+    buff += 4;
+    len -= 4;
+  }
+#endif
+
+  while(len--) {
+    w = (w << 8) ^ t[0][(w >> 24) ^ *buff++];
+  }
+  return(w >> (32 - this->size));
+}
+
+uint32_t RadioLibCRC::updateReflected(uint32_t crc, const uint8_t* buff, size_t len) {
+  uint32_t (*t)[256] = this->table;
+  uint32_t w = crc;
+
+#if RADIOLIB_CRC_TABLE_SLICES == 8
+  while(len >= 8) {
+    w ^= RADIOLIB_CRC_LOAD_LE(buff);
+    w = t[7][w & 0xFF] ^ t[6][(w >> 8) & 0xFF] ^ t[5][(w >> 16) & 0xFF] ^ t[4][w >> 24] ^
+        t[3][buff[4]] ^ t[2][buff[5]] ^ t[1][buff[6]] ^ t[0][buff[7]];
+    buff += 8;
+    len -= 8;
+  }
+#elif RADIOLIB_CRC_TABLE_SLICES == 4
+  while(len >= 4) {
+    w ^= RADIOLIB_CRC_LOAD_LE(buff);
+    w = t[3][w & 0xFF] ^ t[2][(w >> 8) & 0xFF] ^ t[1][(w >> 16) & 0xFF] ^ t[0][w >> 24];
+    buff += 4;
+    len -= 4;
+  }
+#endif
+
+  while(len--) {
+    w = (w >> 8) ^ t[0][(w ^ *buff++) & 0xFF];
+  }
+  return(w);
+}
+#endif
+
+uint32_t RadioLibCRC::updateHardware(uint32_t crc, const uint8_t* buff, size_t len, bool* done) {
+  // the instructions work on the reflected 32-bit register, init and final XOR are up to the caller
+  *done = false;
+  if(this->size != 32) {
+    return(crc);
+  }
+
+#if defined(__ARM_FEATURE_CRC32)
+  if(this->poly == RADIOLIB_CRC_CRC32_POLY) {
+    for(; len >= 4; buff += 4, len -= 4) {
+      crc = __crc32w(crc, RADIOLIB_CRC_LOAD_LE(buff));
+    }
+    while(len--) {
+      crc = __crc32b(crc, *buff++);
+    }
+    *done = true;
+  } else if(this->poly == RADIOLIB_CRC_CRC32C_POLY) {
+    for(; len >= 4; buff += 4, len -= 4) {
+      crc = __crc32cw(crc, RADIOLIB_CRC_LOAD_LE(buff));
+    }
+    while(len--) {
+      crc = __crc32cb(crc, *buff++);
+    }
+    *done = true;
+  }
+#elif defined(__SSE4_2__)
+  // x86 only implements CRC-32C
+  if(this->poly == RADIOLIB_CRC_CRC32C_POLY) {
+    for(; len >= 4; buff += 4, len -= 4) {
+      crc = _mm_crc32_u32(crc, RADIOLIB_CRC_LOAD_LE(buff));
+    }
+    while(len--) {
+      crc = _mm_crc32_u8(crc, *buff++);
+    }
+    *done = true;
+  }
+#else
+  (void)buff;
+  (void)len;
+#endif
+
+  return(crc);
+}
+
+uint32_t RadioLibCRC::updateBitwise(uint32_t crc, const uint8_t* buff, size_t len) {
   size_t pos = 0;
   for(size_t i = 0; i < 8*len; i++) {
     if(i % 8 == 0) {
@@ -23,12 +223,6 @@ uint32_t RadioLibCRC::checksum(uint8_t* buff, size_t len) {
       crc <<= (uint32_t)1;
     }
   }
-
-  crc ^= this->out;
-  if(this->refOut) {
-    crc = Module::reflect(crc, this->size);
-  }
-  crc &= (uint32_t)0xFFFFFFFF >> (32 - this->size);
   return(crc);
 }
 
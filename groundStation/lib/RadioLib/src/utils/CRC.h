@@ -12,9 +12,21 @@
 #define RADIOLIB_CRC_CCITT_INIT                                 (0xFFFF)
 #define RADIOLIB_CRC_CCITT_OUT                                  (0xFFFF)
 
+// CRC-32 polynomials that some CPUs calculate in hardware
+#define RADIOLIB_CRC_CRC32_POLY                                 (0x04C11DB7)
+#define RADIOLIB_CRC_CRC32C_POLY                                (0x1EDC6F41)
+
+#if (RADIOLIB_CRC_TABLE_SLICES != 0) && (RADIOLIB_CRC_TABLE_SLICES != 1) && (RADIOLIB_CRC_TABLE_SLICES != 4) && (RADIOLIB_CRC_TABLE_SLICES != 8)
+  #error "RADIOLIB_CRC_TABLE_SLICES must be 0, 1, 4 or 8"
+#endif
+
 /*!
   \class RadioLibCRC
   \brief Class to calculate CRCs of varying formats.
+
+  Unless disabled by RADIOLIB_CRC_TABLE_SLICES, lookup tables for the configured size, polynomial
+  and input reflection are generated on the first checksum and reused until those change.
+  Reflected CRC-32 and CRC-32C use the CPU CRC instructions where the compiler targets them.
 */
 class RadioLibCRC {
   public:
@@ -60,6 +72,23 @@ class RadioLibCRC {
       \returns The resulting checksum.
     */
     uint32_t checksum(uint8_t* buff, size_t len);
+
+#if !RADIOLIB_GODMODE
+  private:
+#endif
+#if RADIOLIB_CRC_TABLE_SLICES
+    uint32_t table[RADIOLIB_CRC_TABLE_SLICES][256];
+    bool tableValid;
+    uint8_t tableSize;
+    uint32_t tablePoly;
+    bool tableRefIn;
+
+    void generateTable();
+    uint32_t update(uint32_t crc, const uint8_t* buff, size_t len);
+    uint32_t updateReflected(uint32_t crc, const uint8_t* buff, size_t len);
+#endif
+    uint32_t updateHardware(uint32_t crc, const uint8_t* buff, size_t len, bool* done);
+    uint32_t updateBitwise(uint32_t crc, const uint8_t* buff, size_t len);
 };
 
 // the global singleton
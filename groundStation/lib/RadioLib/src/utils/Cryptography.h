@@ -12,9 +12,34 @@
 #define RADIOLIB_AES128_N_R                                     (10)
 #define RADIOLIB_AES128_KEY_EXP_SIZE                            (176)
 
+// AES-NI is only available when the compiler targets it
+#if (RADIOLIB_AES128_BACKEND >= RADIOLIB_AES128_BACKEND_AESNI) && defined(__AES__)
+  #define RADIOLIB_AES128_AESNI                                 (1)
+#else
+  #define RADIOLIB_AES128_AESNI                                 (0)
+#endif
+
 // helper type
 typedef uint8_t state_t[4][4];
 
+/*!
+  \struct RadioLibCMAC_t
+  \brief Structure to hold the state of a CMAC calculated over several calls.
+*/
+struct RadioLibCMAC_t {
+  /*! \brief Key the CMAC is calculated with */
+  uint8_t key[RADIOLIB_AES128_KEY_SIZE];
+
+  /*! \brief Result of the blocks processed so far */
+  uint8_t chain[RADIOLIB_AES128_BLOCK_SIZE];
+
+  /*! \brief Last block, held back until it is known whether it is the final one */
+  uint8_t block[RADIOLIB_AES128_BLOCK_SIZE];
+
+  /*! \brief Number of bytes in the last block */
+  uint8_t len;
+};
+
 // AES lookup tables
 static const uint8_t aesSbox[] RADIOLIB_NONVOLATILE = {
     0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5,
@@ -102,11 +127,31 @@ class RadioLibAES128 {
     RadioLibAES128();
 
     /*!
-      \brief Initialize the AES.
+      \brief Initialize the AES. The expanded key schedule is cached, so switching between
+      a few keys (e.g. the LoRaWAN session keys) only expands each of them once.
       \param key AES key to use.
     */
     void init(uint8_t* key);
 
+    /*!
+      \brief Wipe all cached key schedules, e.g. when the keys are no longer valid.
+    */
+    void clearKeys();
+
+    /*!
+      \brief Select the encryption backend, see RADIOLIB_AES128_BACKEND for the options.
+      The default is the fastest one that was compiled in and is supported by the CPU.
+      \param backend Backend to use.
+      \returns \ref status_codes, RADIOLIB_ERR_UNSUPPORTED if the backend was not compiled in or the CPU lacks it.
+    */
+    int16_t setBackend(uint8_t backend);
+
+    /*!
+      \brief Get the encryption backend in use.
+      \returns The active backend.
+    */
+    uint8_t getBackend() const;
+
     /*!
       \brief Perform ECB-type AES encryption.
       \param in Input plaintext data (unpadded).
@@ -143,13 +188,57 @@ class RadioLibAES128 {
       \returns True if valid, false otherwise.
     */
     bool verifyCMAC(uint8_t* in, size_t len, uint8_t* cmac);
+
+    /*!
+      \brief Start calculating a CMAC over data that arrives in several parts.
+      Several CMACs may be calculated at the same time, each with its own key.
+      \param ctx CMAC state to initialize.
+      \param key AES key to use.
+    */
+    void beginCMAC(RadioLibCMAC_t* ctx, uint8_t* key);
+
+    /*!
+      \brief Add data to a CMAC started by beginCMAC.
+      \param ctx CMAC state.
+      \param in Input data, of any length.
+      \param len Length of the input data.
+    */
+    void updateCMAC(RadioLibCMAC_t* ctx, const uint8_t* in, size_t len);
+
+    /*!
+      \brief Finish a CMAC started by beginCMAC. The result is the same as from generateCMAC
+      over all the data passed to updateCMAC.
+      \param ctx CMAC state.
+      \param cmac Buffer to save the output MAC into. The buffer must be at least 16 bytes long!
+    */
+    void finishCMAC(RadioLibCMAC_t* ctx, uint8_t* cmac);
   
   private:
     uint8_t* keyPtr;
-    uint8_t roundKey[RADIOLIB_AES128_KEY_EXP_SIZE];
+    uint8_t* roundKey;
+
+    // expanded keys, the least recently used one is replaced when a new key is initialized
+    uint8_t cacheKeys[RADIOLIB_AES128_KEY_CACHE_SIZE][RADIOLIB_AES128_KEY_SIZE];
+    uint8_t cacheRoundKeys[RADIOLIB_AES128_KEY_CACHE_SIZE][RADIOLIB_AES128_KEY_EXP_SIZE];
+    uint8_t cacheSubkeys[RADIOLIB_AES128_KEY_CACHE_SIZE][2][RADIOLIB_AES128_BLOCK_SIZE];
+    bool cacheSubkeysValid[RADIOLIB_AES128_KEY_CACHE_SIZE];
+    uint32_t cacheLastUse[RADIOLIB_AES128_KEY_CACHE_SIZE];
+    uint32_t cacheUseCounter;
+    uint8_t cacheActive;
+    uint8_t backend;
 
+    uint8_t findKey(uint8_t* key, bool keepActive);
+    uint8_t selectKey(uint8_t* key, uint8_t* active);
+    void restoreKey(uint8_t entry, uint8_t* active);
     void keyExpansion(uint8_t* roundKey, uint8_t* key);
     void cipher(state_t* state, uint8_t* roundKey);
+    void cipherCompact(state_t* state, uint8_t* roundKey);
+#if RADIOLIB_AES128_BACKEND >= RADIOLIB_AES128_BACKEND_TTABLE
+    void cipherTable(state_t* state, uint8_t* roundKey);
+#endif
+#if RADIOLIB_AES128_AESNI
+    void cipherAesNi(state_t* state, uint8_t* roundKey);
+#endif
     void decipher(state_t* state, uint8_t* roundKey);
 
     void subWord(uint8_t* word);
@@ -159,7 +248,7 @@ class RadioLibAES128 {
 
     void blockXor(uint8_t* dst, uint8_t* a, uint8_t* b);
     void blockLeftshift(uint8_t* dst, uint8_t* src);
-    void generateSubkeys(uint8_t* key1, uint8_t* key2);
+    void generateSubkeys(uint8_t* roundKey, uint8_t* key1, uint8_t* key2);
 
     void subBytes(state_t* state, const uint8_t* box);
     void shiftRows(state_t* state, bool inv);
@@ -2,7 +2,10 @@
 #include <string.h>
 
 RadioLibBCH::RadioLibBCH() {
-  
+  decoderValid = false;
+  #if !RADIOLIB_STATIC_ONLY
+  errorPos = NULL;
+  #endif
 }
 
 /*
@@ -14,7 +17,10 @@ void RadioLibBCH::begin(uint8_t n, uint8_t k, uint32_t poly) {
   this->n = n;
   this->k = k;
   this->poly = poly;
+  this->decoderValid = false;
   #if !RADIOLIB_STATIC_ONLY
+  delete[] this->errorPos;
+  this->errorPos = NULL;
   this->alphaTo = new int32_t[n + 1];
   this->indexOf = new int32_t[n + 1];
   this->generator = new int32_t[n - k + 1];
@@ -290,4 +296,104 @@ uint32_t RadioLibBCH::encode(uint32_t dataword) {
 	return(res);
 }
 
+int16_t RadioLibBCH::decode(uint32_t* codeword, uint8_t* errors) {
+  if(errors) {
+    *errors = 0;
+  }
+  if((this->n > 31) || (this->n - this->k > RADIOLIB_BCH_DECODER_MAX_CHECK_BITS)) {
+    return(RADIOLIB_ERR_UNSUPPORTED);
+  }
+  if(!this->decoderValid) {
+    generateDecoder();
+  }
+  #if !RADIOLIB_STATIC_ONLY
+  if(!this->errorPos) {
+    return(RADIOLIB_ERR_MEMORY_ALLOCATION_FAILED);
+  }
+  #endif
+
+  uint32_t cw = *codeword;
+  uint8_t num = 0;
+  uint32_t s = syndrome(cw);
+  if(s != 0) {
+    uint8_t pos = this->errorPos[s];
+    if(pos) {
+      cw ^= (uint32_t)1 << pos;
+      num = 1;
+    } else {
+      // two errors: remove each possible first error and look up whether a single one remains
+      for(uint8_t i = 1; i <= this->n; i++) {
+        pos = this->errorPos[s ^ this->bitSyndromes[i]];
+        if(pos && (pos != i)) {
+          cw ^= ((uint32_t)1 << i) | ((uint32_t)1 << pos);
+          num = 2;
+          break;
+        }
+      }
+      if(num == 0) {
+        return(RADIOLIB_ERR_UNCORRECTABLE_CODE_WORD);
+      }
+    }
+  }
+
+  // the whole code word has even parity, if it is still odd the parity bit itself was wrong
+  uint32_t parity = cw;
+  parity ^= parity >> 16;
+  parity ^= parity >> 8;
+  parity ^= parity >> 4;
+  parity ^= parity >> 2;
+  parity ^= parity >> 1;
+  if(parity & 0x01) {
+    // with two corrected bits this would make three errors, more than can be corrected
+    if(num == 2) {
+      return(RADIOLIB_ERR_UNCORRECTABLE_CODE_WORD);
+    }
+    cw ^= 0x01;
+    num++;
+  }
+
+  *codeword = cw;
+  if(errors) {
+    *errors = num;
+  }
+  return(RADIOLIB_ERR_NONE);
+}
+
+void RadioLibBCH::generateDecoder() {
+  // bit 0 of the code word is the parity bit, the BCH code word starts at bit 1
+  uint8_t r = this->n - this->k;
+  this->genPoly = 0;
+  for(uint8_t i = 0; i <= r; i++) {
+    if(this->generator[i]) {
+      this->genPoly |= (uint32_t)1 << i;
+    }
+  }
+
+  #if !RADIOLIB_STATIC_ONLY
+  if(!this->errorPos) {
+    this->errorPos = new uint8_t[(size_t)1 << r];
+  }
+  #endif
+  memset(this->errorPos, 0x00, (size_t)1 << r);
+
+  this->bitSyndromes[0] = 0;
+  for(uint8_t i = 1; i <= this->n; i++) {
+    this->bitSyndromes[i] = syndrome((uint32_t)1 << i);
+    this->errorPos[this->bitSyndromes[i]] = i;
+  }
+  this->decoderValid = true;
+}
+
+uint32_t RadioLibBCH::syndrome(uint32_t codeword) {
+  // remainder of the received polynomial divided by the generator polynomial
+  uint8_t r = this->n - this->k;
+  uint32_t rem = codeword >> 1;
+  for(int8_t i = this->n - 1; i >= r; i--) {
+    if(rem & ((uint32_t)1 << i)) {
+      rem ^= this->genPoly << (i - r);
+    }
+  }
+  return(rem);
+}
+
 RadioLibBCH RadioLibBCHInstance;
@@ -17,6 +17,9 @@
 #define RADIOLIB_BCH_MAX_K                                      (31)
 #endif
 
+// the decoder keeps one table entry per syndrome, so it is limited to codes with few check bits
+#define RADIOLIB_BCH_DECODER_MAX_CHECK_BITS                     (10)
+
 /*!
   \class RadioLibBCH
   \brief Class to calculate Bose–Chaudhuri–Hocquenghem (BCH) class of forward error correction codes.
@@ -46,11 +49,36 @@ class RadioLibBCH {
     */
     uint32_t encode(uint32_t dataword);
 
+    /*!
+      \brief Decoding method - corrects up to two bit errors in a code word produced by encode,
+      using the even parity bit to detect a third error. The correction tables are built on the first call.
+      \param codeword Pointer to the received code word, will be corrected in-place.
+      When the code word cannot be corrected, it is left as received.
+      \param errors Pointer to variable to save the number of corrected bits to, may be NULL.
+      \returns \ref status_codes
+    */
+    int16_t decode(uint32_t* codeword, uint8_t* errors = NULL);
+
   private:
     uint8_t n;
     uint8_t k;
     uint32_t poly;
     uint8_t m;
+
+    // generator polynomial packed into bits, and the syndrome of an error in each bit of the code word
+    uint32_t genPoly;
+    uint32_t bitSyndromes[32];
+
+    // position of the single bit error for each syndrome, 0 if there is none
+    bool decoderValid;
+    #if RADIOLIB_STATIC_ONLY
+      uint8_t errorPos[1 << RADIOLIB_BCH_DECODER_MAX_CHECK_BITS];
+    #else
+      uint8_t* errorPos;
+    #endif
+
+    void generateDecoder();
+    uint32_t syndrome(uint32_t codeword);
     
     #if RADIOLIB_STATIC_ONLY
       int32_t alphaTo[RADIOLIB_BCH_MAX_N + 1];
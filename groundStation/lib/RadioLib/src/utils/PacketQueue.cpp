@@ -0,0 +1,74 @@
+#include "PacketQueue.h"
+
+#include <string.h>
+
+// keeps the compiler from moving packet accesses across index updates,
+// sufficient for the single-core targets where producer and consumer are an interrupt and the main loop
+#define RADIOLIB_QUEUE_BARRIER() __asm__ __volatile__("" ::: "memory")
+
+RadioLibPacketQueue::RadioLibPacketQueue() {
+
+}
+
+RadioLibPacket_t* RadioLibPacketQueue::reserve() {
+  if(next(this->head) == this->tail) {
+    this->dropped = this->dropped + 1;
+    return(NULL);
+  }
+  return(&this->packets[this->head]);
+}
+
+void RadioLibPacketQueue::commit() {
+  RADIOLIB_QUEUE_BARRIER();
+  this->head = next(this->head);
+}
+
+RadioLibPacket_t* RadioLibPacketQueue::peek() {
+  if(this->head == this->tail) {
+    return(NULL);
+  }
+  RADIOLIB_QUEUE_BARRIER();
+  return(&this->packets[this->tail]);
+}
+
+void RadioLibPacketQueue::pop() {
+  if(this->head == this->tail) {
+    return;
+  }
+  RADIOLIB_QUEUE_BARRIER();
+  this->tail = next(this->tail);
+}
+
+size_t RadioLibPacketQueue::read(RadioLibPacket_t* packets, size_t maxNum) {
+  size_t num = 0;
+  RadioLibPacket_t* packet = peek();
+  while((packet != NULL) && (num < maxNum)) {
+    memcpy(&packets[num], packet, sizeof(RadioLibPacket_t));
+    pop();
+    num++;
+    packet = peek();
+  }
+  return(num);
+}
+
+size_t RadioLibPacketQueue::available() const {
+  uint8_t h = this->head;
+  uint8_t t = this->tail;
+  return((h >= t) ? (h - t) : (RADIOLIB_PACKET_QUEUE_SIZE - t + h));
+}
+
+uint32_t RadioLibPacketQueue::getDropped() const {
+  return(this->dropped);
+}
+
+void RadioLibPacketQueue::clear() {
+  this->tail = this->head;
+}
+
+uint8_t RadioLibPacketQueue::next(uint8_t index) {
+  index++;
+  if(index >= RADIOLIB_PACKET_QUEUE_SIZE) {
+    index = 0;
+  }
+  return(index);
+}
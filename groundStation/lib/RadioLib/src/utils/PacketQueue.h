@@ -0,0 +1,115 @@
+#if !defined(_RADIOLIB_PACKET_QUEUE_H)
+#define _RADIOLIB_PACKET_QUEUE_H
+
+#include "../TypeDef.h"
+
+/*!
+  \struct RadioLibPacketInfo_t
+  \brief Metadata of a received or transmitted packet.
+*/
+struct RadioLibPacketInfo_t {
+  /*! \brief micros() timestamp of the interrupt that signalled the end of the packet (RX done or TX done). */
+  uint32_t timestamp;
+
+  /*! \brief Packet RSSI in dBm, received packets only. */
+  float rssi;
+
+  /*! \brief Packet SNR in dB, received packets only. */
+  float snr;
+
+  /*! \brief Frequency error in Hz, received packets only. 0 if not supported by the module. */
+  float freqError;
+};
+
+/*!
+  \struct RadioLibPacket_t
+  \brief A received packet together with its read status and reception metadata.
+*/
+struct RadioLibPacket_t {
+  /*! \brief Packet payload. */
+  uint8_t data[RADIOLIB_PACKET_QUEUE_MAX_LEN];
+
+  /*! \brief Number of valid bytes in data. */
+  size_t len;
+
+  /*! \brief Status of the read, e.g. RADIOLIB_ERR_CRC_MISMATCH if the payload CRC failed. */
+  int16_t state;
+
+  /*! \brief Reception metadata. */
+  RadioLibPacketInfo_t info;
+};
+
+/*!
+  \class RadioLibPacketQueue
+  \brief Fixed-capacity, lock-free single-producer/single-consumer queue of received packets.
+  The producer (typically the packet received interrupt, via PhysicalLayer::readData) and the consumer (application loop)
+  each only modify their own index, so no locking is needed as long as there is exactly one of each.
+*/
+class RadioLibPacketQueue {
+  public:
+    /*!
+      \brief Default constructor.
+    */
+    RadioLibPacketQueue();
+
+    /*!
+      \brief Get the slot the next packet should be written to. Producer only.
+      \returns Pointer to the free slot, or NULL if the queue is full (the packet is then counted as dropped).
+    */
+    RadioLibPacket_t* reserve();
+
+    /*!
+      \brief Publish the slot returned by reserve to the consumer. Producer only.
+    */
+    void commit();
+
+    /*!
+      \brief Get the oldest queued packet without removing it. Consumer only.
+      \returns Pointer to the packet, or NULL if the queue is empty.
+    */
+    RadioLibPacket_t* peek();
+
+    /*!
+      \brief Remove the oldest queued packet. Consumer only.
+    */
+    void pop();
+
+    /*!
+      \brief Copy out and remove up to maxNum of the oldest queued packets. Consumer only.
+      \param packets Array to save the packets to.
+      \param maxNum Maximum number of packets to read.
+      \returns Number of packets read.
+    */
+    size_t read(RadioLibPacket_t* packets, size_t maxNum);
+
+    /*!
+      \brief Get the number of queued packets.
+      \returns Number of packets that can be read.
+    */
+    size_t available() const;
+
+    /*!
+      \brief Get the number of packets discarded because the queue was full.
+      \returns Number of dropped packets.
+    */
+    uint32_t getDropped() const;
+
+    /*!
+      \brief Discard all queued packets. Consumer only.
+    */
+    void clear();
+
+#if !RADIOLIB_GODMODE
+  private:
+#endif
+    RadioLibPacket_t packets[RADIOLIB_PACKET_QUEUE_SIZE];
+
+    // indices are single bytes so that they are read and written atomically on every platform
+    volatile uint8_t head = 0;
+    volatile uint8_t tail = 0;
+    volatile uint32_t dropped = 0;
+
+    static uint8_t next(uint8_t index);
+};
+
+#endif
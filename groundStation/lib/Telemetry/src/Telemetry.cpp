@@ -0,0 +1,110 @@
+#include "Telemetry.h"
+#include <RadioLib.h>
+
+uint8_t *telemetryPut8(uint8_t *pos, uint8_t value)
+{
+  *pos++ = value;
+  return pos;
+}
+
+uint8_t *telemetryPut16(uint8_t *pos, uint16_t value)
+{
+  *pos++ = value & 0xFF;
+  *pos++ = (value >> 8) & 0xFF;
+  return pos;
+}
+
+uint8_t *telemetryPut32(uint8_t *pos, uint32_t value)
+{
+  pos = telemetryPut16(pos, value & 0xFFFF);
+  return telemetryPut16(pos, (value >> 16) & 0xFFFF);
+}
+
+uint8_t telemetryGet8(const uint8_t *pos)
+{
+  return pos[0];
+}
+
+uint16_t telemetryGet16(const uint8_t *pos)
+{
+  return (uint16_t)pos[0] | ((uint16_t)pos[1] << 8);
+}
+
+uint32_t telemetryGet32(const uint8_t *pos)
+{
+  return (uint32_t)telemetryGet16(pos) | ((uint32_t)telemetryGet16(pos + 2) << 16);
+}
+
+int16_t telemetryFixed16(float value, float scale)
+{
+  float scaled = value * scale;
+  if (scaled >= 32767.0f) return INT16_MAX;
+  if (scaled <= -32768.0f) return INT16_MIN;
+  return (int16_t)lroundf(scaled);
+}
+
+int32_t telemetryFixed32(float value, float scale)
+{
+  float scaled = value * scale;
+  if (scaled >= 2147483520.0f) return INT32_MAX;  // largest float below 2^31
+  if (scaled <= -2147483648.0f) return INT32_MIN;
+  return (int32_t)lroundf(scaled);
+}
+
+static uint16_t telemetryCrc(const uint8_t *data, size_t len)
+{
+  RadioLibCRCInstance.size = 16;
+  RadioLibCRCInstance.poly = RADIOLIB_CRC_CCITT_POLY;
+  RadioLibCRCInstance.init = RADIOLIB_CRC_CCITT_INIT;
+  RadioLibCRCInstance.out = RADIOLIB_CRC_CCITT_OUT;
+  RadioLibCRCInstance.refIn = false;
+  RadioLibCRCInstance.refOut = false;
+  return RadioLibCRCInstance.checksum((uint8_t *)data, len);
+}
+
+size_t telemetryEncode(uint8_t *frame, uint8_t sensorId, uint16_t seq, uint32_t timestamp, const uint8_t *payload, uint8_t payloadLen)
+{
+  if (payloadLen > TELEMETRY_MAX_PAYLOAD) {
+    return 0;
+  }
+
+  uint8_t *pos = frame;
+  pos = telemetryPut8(pos, TELEMETRY_SYNC_0);
+  pos = telemetryPut8(pos, TELEMETRY_SYNC_1);
+  pos = telemetryPut8(pos, TELEMETRY_VERSION);
+  pos = telemetryPut8(pos, sensorId);
+  pos = telemetryPut16(pos, seq);
+  pos = telemetryPut32(pos, timestamp);
+  pos = telemetryPut8(pos, payloadLen);
+  memcpy(pos, payload, payloadLen);
+  pos += payloadLen;
+
+  // CRC covers everything after the sync word
+  pos = telemetryPut16(pos, telemetryCrc(&frame[2], pos - &frame[2]));
+
+  return pos - frame;
+}
+
+int telemetryDecode(const uint8_t *frame, size_t len, uint8_t *sensorId, uint16_t *seq, uint32_t *timestamp, const uint8_t **payload)
+{
+  if (len < TELEMETRY_HEADER_LEN + TELEMETRY_CRC_LEN) {
+    return -1;
+  }
+  if ((frame[0] != TELEMETRY_SYNC_0) || (frame[1] != TELEMETRY_SYNC_1) || (frame[2] != TELEMETRY_VERSION)) {
+    return -1;
+  }
+
+  uint8_t payloadLen = frame[10];
+  if ((payloadLen > TELEMETRY_MAX_PAYLOAD) || (len != (size_t)TELEMETRY_HEADER_LEN + payloadLen + TELEMETRY_CRC_LEN)) {
+    return -1;
+  }
+  if (telemetryGet16(&frame[TELEMETRY_HEADER_LEN + payloadLen]) != telemetryCrc(&frame[2], TELEMETRY_HEADER_LEN - 2 + payloadLen)) {
+    return -1;
+  }
+
+  *sensorId = frame[3];
+  *seq = telemetryGet16(&frame[4]);
+  *timestamp = telemetryGet32(&frame[6]);
+  *payload = &frame[TELEMETRY_HEADER_LEN];
+  return payloadLen;
+}
@@ -0,0 +1,82 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <Arduino.h>
+
+// Binary telemetry frame format, version 1
+//
+//   offset  size  field
+//   0       2     sync word (0xAA 0x55)
+//   2       1     protocol version
+//   3       1     sensor ID
+//   4       2     sequence number (little endian)
+//   6       4     timestamp in ms (little endian)
+//   10      1     payload length
+//   11      n     fixed-point payload (little endian)
+//   11+n    2     CRC-16/CCITT over bytes 2 .. 10+n (little endian)
+#define TELEMETRY_SYNC_0 0xAA
+#define TELEMETRY_SYNC_1 0x55
+#define TELEMETRY_VERSION 1
+
+#define TELEMETRY_HEADER_LEN 11
+#define TELEMETRY_CRC_LEN 2
+#define TELEMETRY_MAX_PAYLOAD 32
+#define TELEMETRY_MAX_FRAME (TELEMETRY_HEADER_LEN + TELEMETRY_MAX_PAYLOAD + TELEMETRY_CRC_LEN)
+
+// Sensor IDs, numbered the same way as the dashboard where possible
+#define TELEMETRY_ID_GNSS 1     // int32 lat (1e-7 deg), int32 lon (1e-7 deg), uint8 SIV
+#define TELEMETRY_ID_LPS22HB 2  // int32 pressure (0.01 Pa), int16 temperature (0.01 C), int32 altitude (cm)
+#define TELEMETRY_ID_BMI270 3   // int16 accel xyz (mg), int16 gyro xyz (0.1 dps)
+#define TELEMETRY_ID_BMM150 5   // int16 mag xyz (0.1 uT)
+#define TELEMETRY_ID_HS300X 6   // int16 temperature (0.01 C), int16 humidity (0.01 %RH)
+#define TELEMETRY_ID_TASK_STATS 9  // uint8 task, uint32 runs, uint32 overruns, uint32 skipped, uint32 max jitter (us), uint32 max exec (us)
+#define TELEMETRY_ID_UPLINK 10     // uint32 packets sent, uint32 packets failed, uint32 frames dropped (queue full), uint8 data rate index
+#define TELEMETRY_ID_STATUS 11     // uint8 status code, int32 value
+
+// Status codes of TELEMETRY_ID_STATUS frames and the meaning of their value
+#define TELEMETRY_STATUS_READY 0           // all sensors initialized, value unused
+#define TELEMETRY_STATUS_GNSS_FAILED 1     // value unused
+#define TELEMETRY_STATUS_LPS22HB_FAILED 2  // value unused
+#define TELEMETRY_STATUS_IMU_FAILED 3      // value unused
+#define TELEMETRY_STATUS_HS300X_FAILED 4   // value unused
+#define TELEMETRY_STATUS_RADIO_FAILED 5    // value is the RadioLib error code
+#define TELEMETRY_STATUS_ADR_FAILED 6      // value is the RadioLib error code
+#define TELEMETRY_STATUS_GYRO_RATE 7       // value is the sample rate (0.01 Hz)
+#define TELEMETRY_STATUS_ACCEL_RATE 8      // value is the sample rate (0.01 Hz)
+#define TELEMETRY_STATUS_MAG_RATE 9        // value is the sample rate (0.01 Hz)
+
+// Fixed-point scale factors (value on the wire = physical value * scale)
+#define TELEMETRY_SCALE_ACCEL 1000.0f     // g -> mg
+#define TELEMETRY_SCALE_GYRO 10.0f        // dps -> 0.1 dps
+#define TELEMETRY_SCALE_MAG 10.0f         // uT -> 0.1 uT
+#define TELEMETRY_SCALE_PRESSURE 100000.0f  // kPa -> 0.01 Pa
+#define TELEMETRY_SCALE_TEMPERATURE 100.0f  // C -> 0.01 C
+#define TELEMETRY_SCALE_ALTITUDE 100.0f   // m -> cm
+#define TELEMETRY_SCALE_HUMIDITY 100.0f   // %RH -> 0.01 %RH
+#define TELEMETRY_SCALE_RATE 100.0f       // Hz -> 0.01 Hz
+
+// Standard gravity, decoders report acceleration in m/s² (physical value = g * TELEMETRY_GRAVITY)
+#define TELEMETRY_GRAVITY 9.80665f
+
+// Helpers to append little endian values to a payload, each returns the new write position
+uint8_t *telemetryPut8(uint8_t *pos, uint8_t value);
+uint8_t *telemetryPut16(uint8_t *pos, uint16_t value);
+uint8_t *telemetryPut32(uint8_t *pos, uint32_t value);
+
+// Helpers to read little endian values from a payload
+uint8_t telemetryGet8(const uint8_t *pos);
+uint16_t telemetryGet16(const uint8_t *pos);
+uint32_t telemetryGet32(const uint8_t *pos);
+
+// Convert a float to saturated fixed-point
+int16_t telemetryFixed16(float value, float scale);
+int32_t telemetryFixed32(float value, float scale);
+
+// Build a complete frame into `frame` (at least TELEMETRY_MAX_FRAME bytes), returns the frame length or 0 on error
+size_t telemetryEncode(uint8_t *frame, uint8_t sensorId, uint16_t seq, uint32_t timestamp, const uint8_t *payload, uint8_t payloadLen);
+
+// Check a received frame (sync word, version, length and CRC) and extract its header fields,
+// `payload` is set to point into the frame. Returns the payload length or -1 if the frame is invalid
+int telemetryDecode(const uint8_t *frame, size_t len, uint8_t *sensorId, uint16_t *seq, uint32_t *timestamp, const uint8_t **payload);
+
+#endif
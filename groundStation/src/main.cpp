@@ -1,6 +1,7 @@
 #include <Arduino.h>
 #include <RadioLib.h>
 #include <SparkFun_u-blox_GNSS_v3.h>
+#include <Telemetry.h>
 
 // Define pins for the RFM95 LoRa module
 #define NSS_PIN 4   // Chip select pin
@@ -17,6 +18,186 @@ SFE_UBLOX_GNSS myGNSS; // Create an instance for the u-blox GNSS module
 unsigned long lastGPSUpdate = 0;
 const unsigned long gpsUpdateInterval = 5000; // 5 seconds in milliseconds
 
+// Adaptive data rate, the tracker asks for the rate to use every few packets
+LinkAdrClient adr(&radio);
+uint8_t adrNextIndex = 0;       // Rate to send in the next reply
+unsigned long lastPacketTime = 0;
+const unsigned long linkTimeout = 10000; // Fall back to the most robust rate after 10 s without packets
+
+// Queue of received packets, read out of the radio as soon as DIO0 fires
+RadioLibPacketQueue rxQueue;
+unsigned long rxMissed = 0; // Packets overwritten in the radio before they could be read
+
+// Set from the DIO0 interrupt, SPI cannot be used in interrupt context on mbed
+volatile uint8_t rxEvents = 0;
+
+// Function called from the DIO0 interrupt when a packet has been received
+void onPacketReceived()
+{
+  rxEvents++;
+}
+
+// Function to move the packet waiting in the radio into the queue
+void serviceRadio()
+{
+  if (rxEvents == 0) {
+    return;
+  }
+
+  noInterrupts();
+  uint8_t events = rxEvents;
+  rxEvents = 0;
+  interrupts();
+
+  // The radio only keeps the latest packet, any earlier ones were overwritten
+  rxMissed += events - 1;
+  radio.readData(rxQueue);
+}
+
+// The tracker packs several telemetry frames into each packet
+LinkAggregationClient aggregator(&radio);
+
+// Function to print one line in the text format the dashboard reads, "Received packet: [id;v1,v2,...]"
+void printValues(uint8_t sensorId, const double *values, size_t count, int digits)
+{
+  Serial.print(F("Received packet: ["));
+  Serial.print(sensorId);
+  Serial.print(F(";"));
+  for (size_t i = 0; i < count; i++) {
+    if (i > 0) {
+      Serial.print(F(","));
+    }
+    Serial.print(values[i], digits);
+  }
+  Serial.println(F("]"));
+}
+
+// Function called for every telemetry frame unpacked from a received packet
+void printRecord(const uint8_t *data, size_t len)
+{
+  uint8_t sensorId;
+  uint16_t seq;
+  uint32_t timestamp;
+  const uint8_t *payload;
+  int payloadLen = telemetryDecode(data, len, &sensorId, &seq, &timestamp, &payload);
+  if (payloadLen < 0) {
+    Serial.println(F("Invalid telemetry frame"));
+    return;
+  }
+
+  // Convert the fixed-point payload back to physical units, the layouts are listed in Telemetry.h
+  double values[6];
+  if ((sensorId == TELEMETRY_ID_GNSS) && (payloadLen == 9)) {
+    values[0] = (int32_t)telemetryGet32(&payload[0]) / 1e7;
+    values[1] = (int32_t)telemetryGet32(&payload[4]) / 1e7;
+    values[2] = telemetryGet8(&payload[8]);
+    printValues(sensorId, values, 3, 7);
+  } else if ((sensorId == TELEMETRY_ID_LPS22HB) && (payloadLen == 10)) {
+    values[0] = (int32_t)telemetryGet32(&payload[0]) / TELEMETRY_SCALE_PRESSURE;
+    values[1] = (int16_t)telemetryGet16(&payload[4]) / TELEMETRY_SCALE_TEMPERATURE;
+    values[2] = (int32_t)telemetryGet32(&payload[6]) / TELEMETRY_SCALE_ALTITUDE;
+    printValues(sensorId, values, 3, 5);
+  } else if ((sensorId == TELEMETRY_ID_BMI270) && (payloadLen == 12)) {
+    for (int i = 0; i < 3; i++) {
+      values[i] = (int16_t)telemetryGet16(&payload[2*i]) / TELEMETRY_SCALE_ACCEL * TELEMETRY_GRAVITY;
+      values[3 + i] = (int16_t)telemetryGet16(&payload[6 + 2*i]) / TELEMETRY_SCALE_GYRO;
+    }
+    // Acceleration is shown in m/s², same as readSerial.py, and the gyroscope as its own sensor
+    printValues(sensorId, values, 3, 5);
+    printValues(sensorId + 1, &values[3], 3, 5);
+  } else if ((sensorId == TELEMETRY_ID_BMM150) && (payloadLen == 6)) {
+    for (int i = 0; i < 3; i++) {
+      values[i] = (int16_t)telemetryGet16(&payload[2*i]) / TELEMETRY_SCALE_MAG;
+    }
+    printValues(sensorId, values, 3, 5);
+  } else if ((sensorId == TELEMETRY_ID_HS300X) && (payloadLen == 4)) {
+    values[0] = (int16_t)telemetryGet16(&payload[0]) / TELEMETRY_SCALE_TEMPERATURE;
+    values[1] = (int16_t)telemetryGet16(&payload[2]) / TELEMETRY_SCALE_HUMIDITY;
+    printValues(sensorId, values, 2, 5);
+  } else {
+    Serial.print(F("Unknown telemetry frame, sensor ID: "));
+    Serial.println(sensorId);
+  }
+}
+
+// Function to restart reception after the radio was used for something else
+void restartReceive()
+{
+  // Drop the DIO0 events caused by our own transmission
+  noInterrupts();
+  rxEvents = 0;
+  interrupts();
+  radio.startReceive();
+}
+
+// Function to reply with the data rate both ends should use from now on, and switch to it
+void sendAdrFeedback()
+{
+  uint8_t reply[RADIOLIB_LINK_ADR_FEEDBACK_LEN];
+  size_t len = adr.buildFeedback(reply, adrNextIndex);
+  if (radio.transmit(reply, len) == RADIOLIB_ERR_NONE) {
+    adr.setIndex(adrNextIndex);
+  }
+  adrNextIndex = adr.getIndex();
+  restartReceive();
+}
+
+// Function to fall back to the most robust rate when the tracker has not been heard for a while
+void checkLinkTimeout()
+{
+  if ((adr.getIndex() == 0) || (millis() - lastPacketTime < linkTimeout)) {
+    return;
+  }
+
+  adr.fallback();
+  adrNextIndex = 0;
+  lastPacketTime = millis();
+  restartReceive();
+}
+
+// Function to print the oldest queued packet, returns false if the queue is empty
+bool processPacket()
+{
+  RadioLibPacket_t *packet = rxQueue.peek();
+  if (packet == NULL) {
+    return false;
+  }
+
+  if ((packet->state == RADIOLIB_ERR_NONE) && (packet->len >= RADIOLIB_LINK_ADR_HEADER_LEN)) {
+    lastPacketTime = millis();
+    uint8_t next = adr.update(packet->info.snr);
+    if (next != adr.getIndex()) {
+      adrNextIndex = next;
+    }
+
+    // Reply first, the tracker only listens for a short time after its packet
+    if (packet->data[0] & RADIOLIB_LINK_ADR_HEADER_FEEDBACK) {
+      sendAdrFeedback();
+    }
+
+    // Successfully received a packet, print each frame in it
+    int state = aggregator.parse(&packet->data[RADIOLIB_LINK_ADR_HEADER_LEN], packet->len - RADIOLIB_LINK_ADR_HEADER_LEN);
+    if (state != RADIOLIB_ERR_NONE) {
+      Serial.print(F("Unpacking failed, error code: "));
+      Serial.println(state);
+    }
+
+    // Print RSSI and SNR in the exact specified format
+    Serial.print(F("Received packet: [8;"));
+    Serial.print(packet->info.rssi);
+    Serial.print(F(","));
+    Serial.print(packet->info.snr);
+    Serial.println(F("]"));
+  } else {
+    // Print any other error
+    Serial.print(F("Receive failed, error code: "));
+    Serial.println(packet->state);
+  }
+
+  rxQueue.pop();
+  return true;
+}
+
 void setup()
 {
   Serial.begin(9600);
@@ -32,6 +213,7 @@ void setup()
   }
   myGNSS.setI2COutput(COM_TYPE_UBX);
   myGNSS.saveConfigSelective(VAL_CFG_SUBSEC_IOPORT);
+  myGNSS.setAutoPVT(true); // getPVT() returns the latest solution without blocking
 
   // Initialize RFM95 with specific settings
   int state = radio.begin(915.0, 62.5, 12, 8, RADIOLIB_SX127X_SYNC_WORD, 20, 8, 0);
@@ -42,10 +224,43 @@ void setup()
       ; // Stay in the loop forever if the radio initialization failed
   }
 
+  // Start at the most robust rate, same as the tracker
+  state = adr.begin();
+  if (state != RADIOLIB_ERR_NONE)
+  {
+    Serial.print(F("Data rate ladder initialization failed, error code: "));
+    Serial.println(state);
+    while (1)
+      ;
+  }
+
+  aggregator.begin(RADIOLIB_SX127X_MAX_PACKET_LENGTH - RADIOLIB_LINK_ADR_HEADER_LEN);
+  aggregator.setRecordCallback(printRecord);
+
+  // Receive continuously, packets are signalled on DIO0
+  radio.setPacketReceivedAction(onPacketReceived);
+  state = radio.startReceive();
+  if (state != RADIOLIB_ERR_NONE)
+  {
+    Serial.print(F("RFM 95 failed to start receiving, error code: "));
+    Serial.println(state);
+    while (1)
+      ;
+  }
+
   Serial.println(F("RFM 95 Receiver ready!"));
 }
 
 void loop() {
+  // Read out the radio first, the next packet overwrites the one waiting in it
+  serviceRadio();
+  checkLinkTimeout();
+
+  // Print received packets
+  if (processPacket()) {
+    return;
+  }
+
   // Check and print GPS position every 5 seconds
   if (millis() - lastGPSUpdate >= gpsUpdateInterval) {
     lastGPSUpdate = millis(); // Update the last GPS update time
@@ -69,32 +284,12 @@ void loop() {
     {
       Serial.println(F("Waiting for GPS fix..."));
     }
-  }
-
-  // Continue to receive and process packets
-  String receivedData;
-  int state = radio.receive(receivedData);
-  if (state == RADIOLIB_ERR_NONE) {
-    // Successfully received a packet
-    Serial.print(F("Received packet: "));
-    Serial.println(receivedData);
 
-    // Get RSSI and SNR
-    float rssi = radio.getRSSI();
-    float snr = radio.getSNR();
-
-    // Print RSSI and SNR in the exact specified format
-    Serial.print(F("Received packet: [8;"));
-    Serial.print(rssi);
-    Serial.print(F(","));
-    Serial.print(snr);
-    Serial.println(F("]"));
-  } else if (state == RADIOLIB_ERR_RX_TIMEOUT) {
-    // Print error if no packet received
-    Serial.println(F("No packet received, RX timeout."));
-  } else {
-    // Print any other error
-    Serial.print(F("Receive failed, error code: "));
-    Serial.println(state);
+    unsigned long dropped = rxMissed + rxQueue.getDropped();
+    if (dropped > 0)
+    {
+      Serial.print(F("Dropped packets: "));
+      Serial.println(dropped);
+    }
   }
 }
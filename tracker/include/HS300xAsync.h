@@ -0,0 +1,29 @@
+#ifndef HS300X_ASYNC_H
+#define HS300X_ASYNC_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <Arduino_HS300x.h>
+
+#define HS300X_ASYNC_CONVERSION_MS 35  // Worst case humidity + temperature conversion time at 14 bits
+
+// HS300x driver with the measurement split into a request and a later fetch, so the
+// conversion runs while other tasks execute instead of blocking in readTemperature()
+class HS300xAsyncClass : public HS300xClass {
+public:
+  HS300xAsyncClass(TwoWire& wire);
+
+  // Send a measurement request, returns 1 on success or 0 on a bus error
+  int startConversion();
+
+  // Fetch the result of the last request. Returns 1 with both values filled in,
+  // 0 while the conversion is still running, or -1 on a bus error
+  int readConversion(float& temperature, float& humidity);
+
+private:
+  TwoWire* _htWire;
+};
+
+extern HS300xAsyncClass HS300xAsync;
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef IMU_FIFO_H
+#define IMU_FIFO_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <Arduino_BMI270_BMM150.h>
+
+#define IMU_FIFO_RING_SIZE 64         // Software ring buffer size in samples, must be a power of two
+#define IMU_FIFO_FRAME_LEN 12         // Headerless FIFO frame: gyro xyz + accel xyz, 16 bits each
+#define IMU_FIFO_WATERMARK_FRAMES 10  // Frames in the hardware FIFO before the watermark interrupt fires
+#define IMU_FIFO_MAX_BURST_FRAMES 21  // Frames per I2C burst read, limited by the 256 byte Wire buffer
+#define IMU_FIFO_HW_SIZE 2048         // Size of the BMI270 hardware FIFO in bytes
+
+// Scale factors for the ranges configured by the BMI270 library (±4 g, ±2000 dps)
+#define IMU_FIFO_COUNTS_PER_G 8192.0f
+#define IMU_FIFO_COUNTS_PER_DPS 16.384f
+
+// A single accelerometer + gyroscope sample drained from the BMI270 FIFO
+struct IMUSample {
+  int16_t accel[3];    // Raw counts, divide by IMU_FIFO_COUNTS_PER_G for g
+  int16_t gyro[3];     // Raw counts, divide by IMU_FIFO_COUNTS_PER_DPS for dps
+  uint32_t timestamp;  // Sample time in microseconds
+};
+
+// BMI270 driver that batches accelerometer and gyroscope samples in the hardware FIFO.
+// The FIFO watermark interrupt only flags that a batch is ready, the FIFO is then
+// drained from loop() with one burst I2C read, since I2C cannot be used from the ISR.
+class BMI270FifoClass : public BoschSensorClass {
+public:
+  BMI270FifoClass(TwoWire& wire);
+
+  // Attach the watermark interrupt, call after begin()
+  void startFifo();
+
+  // Drain the hardware FIFO into the ring buffer if a batch is ready, returns the number of new samples
+  int drainFifo();
+
+  // Number of samples waiting in the ring buffer
+  int samplesAvailable();
+
+  // Pop the oldest sample from the ring buffer, returns false if empty
+  bool readSample(IMUSample& sample);
+
+  // Number of samples dropped because the ring buffer was full
+  uint32_t droppedSamples() { return _dropped; }
+
+protected:
+  using BoschSensorClass::configure_sensor;
+  int8_t configure_sensor(struct bmi2_dev *dev) override;
+
+private:
+  static void onWatermark();
+  int readFifoLength();
+
+  TwoWire* _fifoWire;
+  bool _fifoReady;
+  uint32_t _samplePeriod;
+  uint32_t _lastDrain;
+  uint32_t _nextTimestamp;  // Time of the next frame in the FIFO, continues the previous batch
+  bool _timelineValid;
+
+  IMUSample _ring[IMU_FIFO_RING_SIZE];
+  uint16_t _head;
+  uint16_t _tail;
+  uint32_t _dropped;
+
+  static volatile bool _watermark;
+};
+
+extern BMI270FifoClass IMUFifo;
+
+#endif
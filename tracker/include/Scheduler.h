@@ -0,0 +1,51 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <Arduino.h>
+
+#define SCHEDULER_MAX_TASKS 8
+
+// Task step function. Returns true once the task has finished its work for the current
+// period, or false to be stepped again on the next pass (non-blocking state machine).
+typedef bool (*TaskFunction)();
+
+// A periodic task and its timing statistics, all times in microseconds
+struct Task {
+  const char *name;
+  TaskFunction fn;
+  uint32_t period;
+  uint32_t deadline;  // Relative to the release time
+  uint32_t release;   // Absolute release time of the current period
+  bool active;        // Started but not yet finished in the current period
+
+  uint32_t runs;       // Completed periods
+  uint32_t overruns;   // Periods completed after the deadline
+  uint32_t skipped;    // Releases missed entirely
+  uint32_t maxJitter;  // Worst start latency after release
+  uint32_t maxExec;    // Worst single step execution time
+};
+
+// Cooperative earliest-deadline-first scheduler. Each call to run() executes one step of
+// the most urgent released task, so slow sensors cannot delay fast ones by a full loop.
+class Scheduler {
+public:
+  Scheduler();
+
+  // Register a task, deadline defaults to the period. Returns the task index or -1 if full.
+  int addTask(const char *name, TaskFunction fn, uint32_t period, uint32_t deadline = 0);
+
+  // Run one step of the released task with the earliest deadline, returns false if idle
+  bool run();
+
+  int taskCount() { return _count; }
+  const Task& task(int index) { return _tasks[index]; }
+
+  // Clear the statistics of all tasks
+  void resetStats();
+
+private:
+  Task _tasks[SCHEDULER_MAX_TASKS];
+  int _count;
+};
+
+#endif
@@ -1,99 +0,0 @@
-/*
-  RadioLib CC1101 Blocking Receive Example
-
-  This example receives packets using CC1101 FSK radio module.
-  To successfully receive data, the following settings have to be the same
-  on both transmitter and receiver:
-  - carrier frequency
-  - bit rate
-  - frequency deviation
-  - sync word
-
-  Using blocking receive is not recommended, as it will lead
-  to significant amount of timeouts, inefficient use of processor
-  time and can some miss packets!
-  Instead, interrupt receive is recommended.
-
-  For default module settings, see the wiki page
-  https://github.com/jgromes/RadioLib/wiki/Default-configuration#cc1101
-
-  For full API reference, see the GitHub Pages
-  https://jgromes.github.io/RadioLib/
-*/
-
-// include the library
-#include <RadioLib.h>
-
-// CC1101 has the following connections:
-// CS pin:    10
-// GDO0 pin:  2
-// RST pin:   unused
-// GDO2 pin:  3 (optional)
-CC1101 radio = new Module(10, 2, RADIOLIB_NC, 3);
-
-// or using RadioShield
-// https://github.com/jgromes/RadioShield
-//CC1101 radio = RadioShield.ModuleA;
-
-void setup() {
-  Serial.begin(9600);
-
-  // initialize CC1101 with default settings
-  Serial.print(F("[CC1101] Initializing ... "));
-  int state = radio.begin();
-  if (state == RADIOLIB_ERR_NONE) {
-    Serial.println(F("success!"));
-  } else {
-    Serial.print(F("failed, code "));
-    Serial.println(state);
-    while (true);
-  }
-}
-
-void loop() {
-  Serial.print(F("[CC1101] Waiting for incoming transmission ... "));
-
-  // you can receive data as an Arduino String
-  String str;
-  int state = radio.receive(str);
-
-  // you can also receive data as byte array
-  /*
-    byte byteArr[8];
-    int state = radio.receive(byteArr, 8);
-  */
-
-  if (state == RADIOLIB_ERR_NONE) {
-    // packet was successfully received
-    Serial.println(F("success!"));
-
-    // print the data of the packet
-    Serial.print(F("[CC1101] Data:\t\t"));
-    Serial.println(str);
-
-    // print RSSI (Received Signal Strength Indicator)
-    // of the last received packet
-    Serial.print(F("[CC1101] RSSI:\t\t"));
-    Serial.print(radio.getRSSI());
-    Serial.println(F(" dBm"));
-
-    // print LQI (Link Quality Indicator)
-    // of the last received packet, lower is better
-    Serial.print(F("[CC1101] LQI:\t\t"));
-    Serial.println(radio.getLQI());
-
-  } else if (state == RADIOLIB_ERR_RX_TIMEOUT) {
-    // timeout occurred while waiting for a packet
-    Serial.println(F("timeout!"));
-
-  } else if (state == RADIOLIB_ERR_CRC_MISMATCH) {
-    // packet was received, but is malformed
-    Serial.println(F("CRC error!"));
-
-  } else {
-    // some other error occurred
-    Serial.print(F("failed, code "));
-    Serial.println(state);
-
-  }
-}
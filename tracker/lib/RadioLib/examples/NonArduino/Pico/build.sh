@@ -1,8 +0,0 @@
-#!/bin/bash
-
-set -e
-mkdir -p build
-cd build
-cmake ..
-make
-cd ..
@@ -1,92 +0,0 @@
-/*
-   RadioLib RF69 Receive with AES Example
-
-   This example receives packets using RF69 FSK radio module.
-   Packets are decrypted using hardware AES.
-   NOTE: When using address filtering, the address byte is NOT encrypted!
-
-   For default module settings, see the wiki page
-   https://github.com/jgromes/RadioLib/wiki/Default-configuration#rf69sx1231
-
-   For full API reference, see the GitHub Pages
-   https://jgromes.github.io/RadioLib/
-*/
-
-// include the library
-#include <RadioLib.h>
-
-// RF69 has the following connections:
-// CS pin:    10
-// DIO0 pin:  2
-// RESET pin: 3
-RF69 radio = new Module(10, 2, 3);
-
-// or using RadioShield
-// https://github.com/jgromes/RadioShield
-//RF69 radio = RadioShield.ModuleA;
-
-void setup() {
-  Serial.begin(9600);
-
-  // initialize RF69 with default settings
-  Serial.print(F("[RF69] Initializing ... "));
-  int state = radio.begin();
-  if (state == RADIOLIB_ERR_NONE) {
-    Serial.println(F("success!"));
-  } else {
-    Serial.print(F("failed, code "));
-    Serial.println(state);
-    while (true);
-  }
-
-  // set AES key that will be used to decrypt the packet
-  // NOTE: the key must be exactly 16 bytes long!
-  uint8_t key[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
-                   0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F};
-  radio.setAESKey(key);
-
-  // enable AES encryption
-  radio.enableAES();
-
-  // AES encryption can also be disabled
-  /*
-    radio.disableAES();
-  */
-}
-
-void loop() {
-  Serial.print(F("[RF69] Waiting for incoming transmission ... "));
-
-  // you can receive data as an Arduino String
-  String str;
-  int state = radio.receive(str);
-
-  // you can also receive data as byte array
-  /*
-    byte byteArr[8];
-    int state = radio.receive(byteArr, 8);
-  */
-
-  if (state == RADIOLIB_ERR_NONE) {
-    // packet was successfully received
-    Serial.println(F("success!"));
-
-    // print the data of the packet
-    Serial.print(F("[RF69] Data:\t\t"));
-    Serial.println(str);
-
-  } else if (state == RADIOLIB_ERR_RX_TIMEOUT) {
-    // timeout occurred while waiting for a packet
-    Serial.println(F("timeout!"));
-
-  } else if (state == RADIOLIB_ERR_CRC_MISMATCH) {
-    // packet was received, but is malformed
-    Serial.println(F("CRC error!"));
-
-  } else {
-    // some other error occurred
-    Serial.print(F("failed, code "));
-    Serial.println(state);
-
-  }
-}
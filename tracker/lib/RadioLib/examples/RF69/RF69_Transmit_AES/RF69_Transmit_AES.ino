@@ -1,86 +0,0 @@
-/*
-   RadioLib RF69 Transmit with AES Example
-
-   This example transmits packets using RF69 FSK radio module.
-   Packets are encrypted using hardware AES.
-   NOTE: When using address filtering, the address byte is NOT encrypted!
-
-   For default module settings, see the wiki page
-   https://github.com/jgromes/RadioLib/wiki/Default-configuration#rf69sx1231
-
-   For full API reference, see the GitHub Pages
-   https://jgromes.github.io/RadioLib/
-*/
-
-// include the library
-#include <RadioLib.h>
-
-// RF69 has the following connections:
-// CS pin:    10
-// DIO0 pin:  2
-// RESET pin: 3
-RF69 radio = new Module(10, 2, 3);
-
-// or using RadioShield
-// https://github.com/jgromes/RadioShield
-//RF69 radio = RadioShield.ModuleA;
-
-void setup() {
-  Serial.begin(9600);
-
-  // initialize RF69 with default settings
-  Serial.print(F("[RF69] Initializing ... "));
-  int state = radio.begin();
-  if (state == RADIOLIB_ERR_NONE) {
-    Serial.println(F("success!"));
-  } else {
-    Serial.print(F("failed, code "));
-    Serial.println(state);
-    while (true);
-  }
-
-  // set AES key to encrypt the packet
-  // NOTE: the key must be exactly 16 bytes long!
-  uint8_t key[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
-                   0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F};
-  radio.setAESKey(key);
-
-  // enable AES encryption
-  radio.enableAES();
-
-  // AES encryption can also be disabled
-  /*
-    radio.disableAES();
-  */
-}
-
-void loop() {
-  Serial.print(F("[RF69] Transmitting packet ... "));
-
-  // you can transmit C-string or Arduino string up to 64 characters long
-  int state = radio.transmit("Hello World!");
-
-  // you can also transmit byte array up to 64 bytes long
-  /*
-    byte byteArr[] = {0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF};
-    int state = radio.transmit(byteArr, 8);
-  */
-
-  if (state == RADIOLIB_ERR_NONE) {
-    // the packet was successfully transmitted
-    Serial.println(F("success!"));
-
-  } else if (state == RADIOLIB_ERR_PACKET_TOO_LONG) {
-    // the supplied packet was longer than 64 bytes
-    Serial.println(F("too long!"));
-
-  } else {
-    // some other error occurred
-    Serial.print(F("failed, code "));
-    Serial.println(state);
-
-  }
-
-  // wait for a second before transmitting again
-  delay(1000);
-}
@@ -1,86 +0,0 @@
-/*
-  RadioLib SX123x Blocking Receive Example
-
-  This example receives packets using SX1231 FSK radio module.
-  Other modules from SX123x family can also be used.
-
-  NOTE: SX123x modules offer the same features as RF69 and have the same
-        interface. Please see RF69 examples for examples on AES,
-        address filtering, interrupts and settings.
-
-  Using blocking receive is not recommended, as it will lead
-  to significant amount of timeouts, inefficient use of processor
-  time and can some miss packets!
-  Instead, interrupt receive is recommended.
-
-  For default module settings, see the wiki page
-  https://github.com/jgromes/RadioLib/wiki/Default-configuration#rf69sx1231
-
-  For full API reference, see the GitHub Pages
-  https://jgromes.github.io/RadioLib/
-*/
-
-// include the library
-#include <RadioLib.h>
-
-// SX1231 has the following connections:
-// CS pin:    10
-// DIO0 pin:  2
-// RESET pin: 3
-SX1231 radio = new Module(10, 2, 3);
-
-// or using RadioShield
-// https://github.com/jgromes/RadioShield
-//SX1231 radio = RadioShield.ModuleA;
-
-void setup() {
-  Serial.begin(9600);
-
-  // initialize SX1231 with default settings
-  Serial.print(F("[SX1231] Initializing ... "));
-  int state = radio.begin();
-  if (state == RADIOLIB_ERR_NONE) {
-    Serial.println(F("success!"));
-  } else {
-    Serial.print(F("failed, code "));
-    Serial.println(state);
-    while (true);
-  }
-}
-
-void loop() {
-  Serial.print(F("[SX1231] Waiting for incoming transmission ... "));
-
-  // you can receive data as an Arduino String
-  String str;
-  int state = radio.receive(str);
-
-  // you can also receive data as byte array
-  /*
-    byte byteArr[8];
-    int state = radio.receive(byteArr, 8);
-  */
-
-  if (state == RADIOLIB_ERR_NONE) {
-    // packet was successfully received
-    Serial.println(F("success!"));
-
-    // print the data of the packet
-    Serial.print(F("[SX1231] Data:\t\t"));
-    Serial.println(str);
-
-  } else if (state == RADIOLIB_ERR_RX_TIMEOUT) {
-    // timeout occurred while waiting for a packet
-    Serial.println(F("timeout!"));
-
-  } else if (state == RADIOLIB_ERR_CRC_MISMATCH) {
-    // packet was received, but is malformed
-    Serial.println(F("CRC error!"));
-
-  } else {
-    // some other error occurred
-    Serial.print(F("failed, code "));
-    Serial.println(state);
-
-  }
-}
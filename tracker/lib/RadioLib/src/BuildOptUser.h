@@ -1,12 +0,0 @@
-#if !defined(_RADIOLIB_USER_BUILD_OPTIONS_H)
-#define _RADIOLIB_USER_BUILD_OPTIONS_H
-
-// this file can be used to define any user build options
-// most commonly, RADIOLIB_EXCLUDE_* macros
-// or enabling debug output
-
-//#define RADIOLIB_DEBUG_BASIC        (1)   // basic debugging (e.g. reporting GPIO timeouts or module not being found)
-//#define RADIOLIB_DEBUG_PROTOCOL     (1)   // protocol information (e.g. LoRaWAN internal information)
-//#define RADIOLIB_DEBUG_SPI          (1)   // verbose transcription of all SPI communication - produces large debug logs!
-
-#endif
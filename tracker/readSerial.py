@@ -1,11 +1,102 @@
 import serial
 import csv
+import struct
 import time
 
 # Replace 'COM3' with the appropriate serial port for your system
 serial_port = '/dev/cu.usbmodem1101'  # For Windows, it might be 'COM3', 'COM4', etc.
 baud_rate = 115200  # Set to the baud rate used in your Arduino code
 
+# Binary telemetry frame format, must match groundStation/lib/Telemetry/src/Telemetry.h
+SYNC = b'\xAA\x55'
+VERSION = 1
+HEADER_LEN = 11
+CRC_LEN = 2
+MAX_PAYLOAD = 32
+GRAVITY = 9.80665  # Conversion factor from g to m/s², TELEMETRY_GRAVITY in Telemetry.h
+
+# Sensor ID -> (name, struct format of the payload, scale factor of each field)
+SENSORS = {
+    1: ('GPS', '<iiB', (1, 1, 1)),
+    2: ('LPS22', '<ihi', (1 / 100000, 1 / 100, 1 / 100)),
+    3: ('BMI270', '<hhhhhh', (GRAVITY / 1000, GRAVITY / 1000, GRAVITY / 1000, 1 / 10, 1 / 10, 1 / 10)),
+    5: ('BMM150', '<hhh', (1 / 10, 1 / 10, 1 / 10)),
+    6: ('HS300x', '<hh', (1 / 100, 1 / 100)),
+    9: ('TASK', '<BIIIII', (1, 1, 1, 1, 1, 1)),
+    10: ('UPLINK', '<IIIB', (1, 1, 1, 1)),
+    11: ('STATUS', '<Bi', (1, 1)),
+}
+STATUS_ID = 11
+
+# Status code -> (message, scale factor of the value or None if unused)
+STATUS_CODES = {
+    0: ('All sensors init success', None),
+    1: ('u-blox GNSS not detected at default I2C address', None),
+    2: ('Failed to init LPS22HB', None),
+    3: ('Failed to init IMU', None),
+    4: ('Failed to init HS300x', None),
+    5: ('Failed to init RFM95, error code', 1),
+    6: ('Failed to init data rate ladder, error code', 1),
+    7: ('Gyro sample rate (Hz)', 1 / 100),
+    8: ('Accelerometer sample rate (Hz)', 1 / 100),
+    9: ('Magnetometer sample rate (Hz)', 1 / 100),
+}
+
+
+def crc16_ccitt(data):
+    # CRC-16/CCITT as configured in RadioLibCRC (poly 0x1021, init 0xFFFF, final XOR 0xFFFF, no reflection)
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            if crc & 0x8000:
+                crc = ((crc << 1) ^ 0x1021) & 0xFFFF
+            else:
+                crc = (crc << 1) & 0xFFFF
+    return crc ^ 0xFFFF
+
+
+def decode_frames(buf):
+    # Decode all complete frames in buf, returns the decoded frames and the unconsumed remainder
+    frames = []
+    while True:
+        start = buf.find(SYNC)
+        if start < 0:
+            # keep a trailing sync byte, it may be the start of the next frame
+            return frames, buf[-1:] if buf.endswith(SYNC[:1]) else b''
+        buf = buf[start:]
+        if len(buf) < HEADER_LEN:
+            return frames, buf
+
+        version, sensor_id, seq, device_ms, payload_len = struct.unpack_from('<BBHIB', buf, 2)
+        if version != VERSION or payload_len > MAX_PAYLOAD:
+            buf = buf[1:]
+            continue
+
+        frame_len = HEADER_LEN + payload_len + CRC_LEN
+        if len(buf) < frame_len:
+            return frames, buf
+
+        crc, = struct.unpack_from('<H', buf, HEADER_LEN + payload_len)
+        if crc != crc16_ccitt(buf[2:HEADER_LEN + payload_len]):
+            buf = buf[1:]
+            continue
+
+        payload = buf[HEADER_LEN:HEADER_LEN + payload_len]
+        buf = buf[frame_len:]
+        if sensor_id not in SENSORS:
+            continue
+
+        name, fmt, scales = SENSORS[sensor_id]
+        if struct.calcsize(fmt) != payload_len:
+            continue
+        values = [v * s for v, s in zip(struct.unpack(fmt, payload), scales)]
+        if sensor_id == STATUS_ID:
+            message, scale = STATUS_CODES.get(values[0], (f"Unknown status {values[0]}", 1))
+            values = [message] if scale is None else [message, values[1] * scale]
+        frames.append((name, seq, device_ms, values))
+
+
 # Open the serial port
 ser = serial.Serial(serial_port, baud_rate, timeout=1)
 
@@ -15,17 +106,27 @@ with open('sensor_data.csv', 'w', newline='') as csvfile:
     # Write the header row
     csv_writer.writerow(['Timestamp', 'Sensor', 'Data'])
 
+    pending = b''
+    last_seq = None
     while True:
         try:
-            # Read a line from the serial port
-            line = ser.readline().decode('utf-8').strip()
-            if line:
+            # Read whatever is available from the serial port and decode complete frames
+            chunk = ser.read(ser.in_waiting or 1)
+            if not chunk:
+                continue
+            frames, pending = decode_frames(pending + chunk)
+            for name, seq, device_ms, values in frames:
+                if last_seq is not None and seq != (last_seq + 1) & 0xFFFF:
+                    print(f"Lost {(seq - last_seq - 1) & 0xFFFF} frame(s)")
+                last_seq = seq
+
                 # Get the current timestamp in milliseconds
                 timestamp = int(time.time() * 1000)
+                data = ','.join(f"{v:.5f}" if isinstance(v, float) else str(v) for v in values + [device_ms])
                 # Print to console (optional)
-                print(f"{timestamp}: {line}")
+                print(f"{timestamp}: {name},{data}")
                 # Write to CSV file
-                csv_writer.writerow([timestamp] + line.split(": "))
+                csv_writer.writerow([timestamp, name, data])
         except serial.SerialException as e:
             print(f"Serial error: {e}")
             break
@@ -0,0 +1,48 @@
+#include "HS300xAsync.h"
+
+#define HS300X_ADDRESS 0x44
+
+#define HS300X_STATUS_MASK 0xC0  // Status bits of the first data byte, non-zero while the data is stale
+#define HS300X_RAW_MAX 16383.0f  // 14 bit full scale
+
+HS300xAsyncClass::HS300xAsyncClass(TwoWire& wire) :
+  HS300xClass(wire),
+  _htWire(&wire)
+{
+}
+
+int HS300xAsyncClass::startConversion()
+{
+  // An empty write is the measurement request
+  _htWire->beginTransmission(HS300X_ADDRESS);
+  return _htWire->endTransmission() == 0;
+}
+
+int HS300xAsyncClass::readConversion(float& temperature, float& humidity)
+{
+  if (_htWire->requestFrom(HS300X_ADDRESS, 4) != 4) {
+    return -1;
+  }
+
+  uint8_t data[4];
+  for (int i = 0; i < 4; i++) {
+    data[i] = _htWire->read();
+  }
+
+  // Until the conversion is done the sensor returns the previous result marked as stale
+  if (data[0] & HS300X_STATUS_MASK) {
+    return 0;
+  }
+
+  uint16_t rawHumidity = ((data[0] & 0x3F) << 8) | data[1];
+  uint16_t rawTemperature = (data[2] << 6) | (data[3] >> 2);
+  humidity = rawHumidity * (100.0f / HS300X_RAW_MAX);
+  temperature = rawTemperature * (165.0f / HS300X_RAW_MAX) - 40.0f;
+  return 1;
+}
+
+#ifdef ARDUINO_ARDUINO_NANO33BLE
+HS300xAsyncClass HS300xAsync(Wire1);
+#else
+HS300xAsyncClass HS300xAsync(Wire);
+#endif
@@ -0,0 +1,228 @@
+#include "IMUFifo.h"
+
+#define BMI270_ADDRESS 0x68
+
+#define BMI270_FIFO_LENGTH_0_REG 0x24
+#define BMI270_FIFO_DATA_REG 0x26
+
+volatile bool BMI270FifoClass::_watermark = false;
+
+BMI270FifoClass::BMI270FifoClass(TwoWire& wire) :
+  BoschSensorClass(wire),
+  _fifoWire(&wire),
+  _fifoReady(false),
+  _samplePeriod(10000),
+  _lastDrain(0),
+  _nextTimestamp(0),
+  _timelineValid(false),
+  _head(0),
+  _tail(0),
+  _dropped(0)
+{
+}
+
+int8_t BMI270FifoClass::configure_sensor(struct bmi2_dev *dev)
+{
+  // Let the library set up ODR, ranges and the interrupt pin first
+  int8_t rslt = BoschSensorClass::configure_sensor(dev);
+  if (rslt != BMI2_OK) {
+    return rslt;
+  }
+
+  // Headerless FIFO with accelerometer and gyroscope frames only
+  rslt = bmi2_set_fifo_config(BMI2_FIFO_ALL_EN, BMI2_DISABLE, dev);
+  if (rslt != BMI2_OK) {
+    return rslt;
+  }
+  rslt = bmi2_set_fifo_config(BMI2_FIFO_ACC_EN | BMI2_FIFO_GYR_EN, BMI2_ENABLE, dev);
+  if (rslt != BMI2_OK) {
+    return rslt;
+  }
+  rslt = bmi2_set_fifo_config(BMI2_FIFO_HEADER_EN, BMI2_DISABLE, dev);
+  if (rslt != BMI2_OK) {
+    return rslt;
+  }
+  rslt = bmi2_set_fifo_wm(IMU_FIFO_WATERMARK_FRAMES * IMU_FIFO_FRAME_LEN, dev);
+  if (rslt != BMI2_OK) {
+    return rslt;
+  }
+
+  // INT1 signals the FIFO watermark instead of every data-ready event
+  struct bmi2_int_pin_config pinConfig;
+  pinConfig.pin_type = BMI2_INT1;
+  rslt = bmi2_get_int_pin_config(&pinConfig, dev);
+  if (rslt != BMI2_OK) {
+    return rslt;
+  }
+  pinConfig.pin_type = BMI2_INT1;
+  pinConfig.int_latch = BMI2_INT_NON_LATCH;
+  pinConfig.pin_cfg[0].lvl = BMI2_INT_ACTIVE_HIGH;
+  pinConfig.pin_cfg[0].od = BMI2_INT_PUSH_PULL;
+  pinConfig.pin_cfg[0].output_en = BMI2_INT_OUTPUT_ENABLE;
+  pinConfig.pin_cfg[0].input_en = BMI2_INT_INPUT_DISABLE;
+  rslt = bmi2_set_int_pin_config(&pinConfig, dev);
+  if (rslt != BMI2_OK) {
+    return rslt;
+  }
+  rslt = bmi2_map_data_int(BMI2_DRDY_INT, BMI2_INT_NONE, dev);
+  if (rslt != BMI2_OK) {
+    return rslt;
+  }
+  rslt = bmi2_map_data_int(BMI2_FWM_INT, BMI2_INT1, dev);
+  if (rslt != BMI2_OK) {
+    return rslt;
+  }
+
+  _fifoReady = true;
+  return BMI2_OK;
+}
+
+void BMI270FifoClass::startFifo()
+{
+  float rate = accelerationSampleRate();
+  if (rate > 0) {
+    _samplePeriod = (uint32_t)(1000000.0f / rate);
+  }
+
+  _head = _tail = 0;
+  _lastDrain = micros();
+  _timelineValid = false;
+  _watermark = false;
+  onInterrupt(onWatermark);
+}
+
+void BMI270FifoClass::onWatermark()
+{
+  _watermark = true;
+}
+
+int BMI270FifoClass::readFifoLength()
+{
+  _fifoWire->beginTransmission(BMI270_ADDRESS);
+  _fifoWire->write(BMI270_FIFO_LENGTH_0_REG);
+  if (_fifoWire->endTransmission(false) != 0) {
+    return -1;
+  }
+
+  if (_fifoWire->requestFrom(BMI270_ADDRESS, 2) != 2) {
+    return -1;
+  }
+
+  int length = _fifoWire->read();
+  length |= (_fifoWire->read() & 0x3F) << 8;
+  return length;
+}
+
+int BMI270FifoClass::drainFifo()
+{
+  if (!_fifoReady) {
+    return 0;
+  }
+
+  // The watermark is edge triggered, so fall back to polling if a batch is overdue
+  uint32_t now = micros();
+  bool overdue = (now - _lastDrain) > 2 * IMU_FIFO_WATERMARK_FRAMES * _samplePeriod;
+  if (!_watermark && !overdue) {
+    return 0;
+  }
+  _watermark = false;
+  _lastDrain = now;
+
+  int length = readFifoLength();
+  if (length <= 0) {
+    return 0;
+  }
+
+  // Samples are timed by counting sample periods from the previous batch, so successive batches
+  // neither overlap nor leave gaps however late the drain runs. The newest frame in the FIFO was
+  // sampled just now, so the timeline restarts from there when frames may have been lost (FIFO
+  // overflow, or a missed watermark), or when the sensor clock has drifted away from micros()
+  int total = length / IMU_FIFO_FRAME_LEN;
+  if (total == 0) {
+    return 0;
+  }
+  uint32_t newest = _nextTimestamp + (total - 1) * _samplePeriod;
+  int32_t drift = (int32_t)(newest - now);
+  bool overflow = length + IMU_FIFO_FRAME_LEN > IMU_FIFO_HW_SIZE;
+  bool drifted = (drift > (int32_t)_samplePeriod) || (-drift > (int32_t)(IMU_FIFO_WATERMARK_FRAMES * _samplePeriod));
+  if (!_timelineValid || overflow || overdue || drifted) {
+    _nextTimestamp = now - (total - 1) * _samplePeriod;
+    _timelineValid = true;
+  }
+
+  int frames = total;
+  if (frames > IMU_FIFO_MAX_BURST_FRAMES) {
+    frames = IMU_FIFO_MAX_BURST_FRAMES;
+    // leave the rest for the next call
+    _watermark = true;
+  }
+
+  // Burst read the whole batch in a single transaction
+  _fifoWire->beginTransmission(BMI270_ADDRESS);
+  _fifoWire->write(BMI270_FIFO_DATA_REG);
+  if (_fifoWire->endTransmission(false) != 0) {
+    return 0;
+  }
+  int len = frames * IMU_FIFO_FRAME_LEN;
+  if (_fifoWire->requestFrom(BMI270_ADDRESS, len) != len) {
+    return 0;
+  }
+
+  uint32_t timestamp = _nextTimestamp;
+  for (int i = 0; i < frames; i++) {
+    int16_t raw[6];
+    for (int j = 0; j < 6; j++) {
+      raw[j] = _fifoWire->read();
+      raw[j] |= _fifoWire->read() << 8;
+    }
+
+    uint16_t next = (_head + 1) & (IMU_FIFO_RING_SIZE - 1);
+    if (next == _tail) {
+      // ring buffer full, drop the oldest sample
+      _tail = (_tail + 1) & (IMU_FIFO_RING_SIZE - 1);
+      _dropped++;
+    }
+
+    // Frames hold gyro then accel, remapped to the board axes like the BMI270 library does
+    IMUSample& sample = _ring[_head];
+#ifdef ARDUINO_ARDUINO_NANO33BLE
+    sample.gyro[0] = -raw[1];
+    sample.gyro[1] = -raw[0];
+    sample.gyro[2] = raw[2];
+    sample.accel[0] = -raw[4];
+    sample.accel[1] = -raw[3];
+    sample.accel[2] = raw[5];
+#else
+    memcpy(sample.gyro, &raw[0], sizeof(sample.gyro));
+    memcpy(sample.accel, &raw[3], sizeof(sample.accel));
+#endif
+    sample.timestamp = timestamp;
+    timestamp += _samplePeriod;
+    _head = next;
+  }
+  _nextTimestamp = timestamp;
+
+  return frames;
+}
+
+int BMI270FifoClass::samplesAvailable()
+{
+  return (_head - _tail) & (IMU_FIFO_RING_SIZE - 1);
+}
+
+bool BMI270FifoClass::readSample(IMUSample& sample)
+{
+  if (_head == _tail) {
+    return false;
+  }
+
+  sample = _ring[_tail];
+  _tail = (_tail + 1) & (IMU_FIFO_RING_SIZE - 1);
+  return true;
+}
+
+#ifdef ARDUINO_ARDUINO_NANO33BLE
+BMI270FifoClass IMUFifo(Wire1);
+#else
+BMI270FifoClass IMUFifo(Wire);
+#endif
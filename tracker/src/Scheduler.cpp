@@ -0,0 +1,93 @@
+#include "Scheduler.h"
+
+// true if time a is at or after time b, safe across micros() wrap-around
+static bool timeReached(uint32_t a, uint32_t b)
+{
+  return (int32_t)(a - b) >= 0;
+}
+
+Scheduler::Scheduler() :
+  _count(0)
+{
+}
+
+int Scheduler::addTask(const char *name, TaskFunction fn, uint32_t period, uint32_t deadline)
+{
+  if (_count >= SCHEDULER_MAX_TASKS) {
+    return -1;
+  }
+
+  Task& task = _tasks[_count];
+  memset(&task, 0, sizeof(task));
+  task.name = name;
+  task.fn = fn;
+  task.period = period;
+  task.deadline = (deadline == 0) ? period : deadline;
+  task.release = micros();
+  _count++;
+
+  return _count - 1;
+}
+
+bool Scheduler::run()
+{
+  uint32_t now = micros();
+
+  // Pick the released task with the earliest absolute deadline
+  Task *next = NULL;
+  for (int i = 0; i < _count; i++) {
+    Task& task = _tasks[i];
+    if (!timeReached(now, task.release)) {
+      continue;
+    }
+    if (next == NULL || !timeReached(task.release + task.deadline, next->release + next->deadline)) {
+      next = &task;
+    }
+  }
+
+  if (next == NULL) {
+    return false;
+  }
+
+  if (!next->active) {
+    next->active = true;
+    uint32_t jitter = now - next->release;
+    if (jitter > next->maxJitter) {
+      next->maxJitter = jitter;
+    }
+  }
+
+  bool done = next->fn();
+  uint32_t end = micros();
+  if (end - now > next->maxExec) {
+    next->maxExec = end - now;
+  }
+
+  if (done) {
+    next->active = false;
+    next->runs++;
+    if (!timeReached(next->release + next->deadline, end)) {
+      next->overruns++;
+    }
+
+    // Schedule the next period, skipping releases that are already in the past
+    next->release += next->period;
+    while (timeReached(end, next->release + next->period)) {
+      next->release += next->period;
+      next->skipped++;
+    }
+  }
+
+  return true;
+}
+
+void Scheduler::resetStats()
+{
+  for (int i = 0; i < _count; i++) {
+    _tasks[i].runs = 0;
+    _tasks[i].overruns = 0;
+    _tasks[i].skipped = 0;
+    _tasks[i].maxJitter = 0;
+    _tasks[i].maxExec = 0;
+  }
+}
@@ -4,82 +4,363 @@
 #include <Arduino_HS300x.h>
 #include <Arduino_LPS22HB.h>
 #include <SparkFun_u-blox_GNSS_v3.h>
+#include <RadioLib.h>
 
-#define GRAVITY 9.80665  // Conversion factor from g to m/s²
-#define BUFF_SIZE 128
+#include "HS300xAsync.h"
+#include "IMUFifo.h"
+#include "Scheduler.h"
+#include "Telemetry.h"
+
+#define BARO_RATE_HZ 75      // LPS22HB output rate, matches RATE_75_HZ
+#define BARO_FIFO_DEPTH 32   // LPS22HB hardware FIFO size in samples
+
+// Pins of the RFM95 LoRa module, wired the same way as on the ground station
+#define NSS_PIN 4   // Chip select pin
+#define DIO0_PIN 3  // DIO0 pin, signals the end of each transmission
+#define RESET_PIN 2 // Reset pin
+
+#define ADR_FEEDBACK_INTERVAL 8   // Uplink packets between data rate feedback requests
+#define ADR_MAX_MISSED 3          // Missed feedback replies before falling back to the most robust rate
+#define ADR_TURNAROUND_MS 250     // Time the ground station may take to start its reply
+
+// Uplink airtime limit over a sliding window. 915 MHz has no duty cycle limit, this keeps the channel free
+// 90 % of the time for the ground station and other users; elsewhere use the regional limit (e.g. 36 s per hour for 1 %)
+#define UPLINK_DUTY_CYCLE_WINDOW_MS 3600000UL
+#define UPLINK_DUTY_CYCLE_LIMIT_MS 360000UL
+#define UPLINK_DEADLINE_MS 60000UL  // Queued packets older than this are stale and dropped
+
+// Share (1/n) of the uplink airtime budget each record type may use, the rest is left as headroom
+#define UPLINK_GNSS_SHARE 2
+#define UPLINK_HS300X_SHARE 4
 
 // Sensor and GPS instances
 SFE_UBLOX_GNSS myGNSS;  // Create an instance for the u-blox GNSS module
 
-char buffer[BUFF_SIZE];
+// Sensor task scheduler
+Scheduler scheduler;
+
+// LoRa uplink to the ground station, frames are queued and sent in the background
+RFM95 radio = new Module(NSS_PIN, DIO0_PIN, RESET_PIN);
+TransmitQueueClient uplink(&radio);
+RadioLibAirtimeBudget uplinkBudget;
+uint32_t uplinkSent = 0;
+uint32_t uplinkFailed = 0;
 
-// Function to read and print GNSS data
-void checkAndPrintGNSSData()
+// Adaptive data rate, the ground station replies with the rate to use to every few uplink packets
+LinkAdrClient adr(&radio);
+uint16_t adrRequestCount = 0;
+uint8_t adrMissed = 0;
+bool adrReplyDue = false;
+volatile bool adrWindowOpen = false;
+volatile bool adrReplyReceived = false;
+unsigned long adrWindowStart = 0;
+unsigned long adrWindowLen = 0;
+
+// Function called from the DIO0 interrupt, SPI cannot be used here on mbed
+void onDio0()
 {
-  myGNSS.checkUblox();  // Poll the GNSS
+  if (adrWindowOpen) {
+    adrReplyReceived = true;
+  } else {
+    uplink.setFlag();
+  }
+}
 
-  long latitude = myGNSS.getLatitude();
-  long longitude = myGNSS.getLongitude();
-  byte SIV = myGNSS.getSIV();
-  unsigned long timestamp = millis();
-  snprintf(buffer, BUFF_SIZE, "GPS,%ld,%ld,%d,%lu", latitude, longitude, SIV, timestamp);
-  Serial.println(buffer);
+// Function called by the uplink queue once a packet has left the radio
+void onUplinkDone(const RadioLibPacket_t *packet)
+{
+  // Dropped packets never went out, they are counted by the queue
+  if ((packet->state == RADIOLIB_ERR_QUEUE_FULL) || (packet->state == RADIOLIB_ERR_DEADLINE_EXPIRED)) {
+    return;
+  }
+
+  if (packet->state == RADIOLIB_ERR_NONE) {
+    uplinkSent++;
+  } else {
+    uplinkFailed++;
+  }
+
+  // Hold the queue so the radio can listen for the reply
+  if (packet->data[0] & RADIOLIB_LINK_ADR_HEADER_FEEDBACK) {
+    uplink.pause();
+    adrReplyDue = true;
+  }
 }
 
-// Function to read and print LPS22HB data
-void checkAndPrintLPS22HBData()
+// Function to listen for the data rate reply after a packet that requested one
+void serviceAdr()
 {
-  float pressure = BARO.readPressure();
-  float temperature = BARO.readTemperature();
-  float altitude = BARO.readAltitude();
-  unsigned long timestamp = millis();
-  snprintf(buffer, BUFF_SIZE, "LPS22,%.5f,%.5f,%.5f,%lu", pressure, temperature, altitude, timestamp);
-  Serial.println(buffer);
+  if (adrReplyDue && !uplink.isBusy()) {
+    adrReplyDue = false;
+    adrReplyReceived = false;
+    adrWindowOpen = true;
+    adrWindowLen = ADR_TURNAROUND_MS + radio.getTimeOnAir(RADIOLIB_LINK_ADR_FEEDBACK_LEN) / 1000;
+    adrWindowStart = millis();
+    radio.startReceive();
+    return;
+  }
+
+  if (!adrWindowOpen) {
+    return;
+  }
+
+  if (adrReplyReceived) {
+    uint8_t reply[RADIOLIB_LINK_ADR_FEEDBACK_LEN];
+    size_t len = 0;
+    uint8_t index = 0;
+    if ((radio.readData(reply, sizeof(reply), &len) == RADIOLIB_ERR_NONE) &&
+        (adr.parseFeedback(reply, len, &index) == RADIOLIB_ERR_NONE)) {
+      adrMissed = 0;
+      adr.setIndex(index);
+    } else {
+      adrMissed++;
+    }
+  } else if (millis() - adrWindowStart > adrWindowLen) {
+    adrMissed++;
+  } else {
+    return;
+  }
+
+  // Without replies the ground station is most likely on another rate, both ends fall back to the most robust one
+  if (adrMissed >= ADR_MAX_MISSED) {
+    adrMissed = 0;
+    adr.fallback();
+  }
+
+  adrWindowOpen = false;
+  radio.standby();
+  uplink.resume();
+}
+
+// Uplink frames are packed together to share the LoRa preamble and header, with room left for the link header
+LinkAggregationClient aggregator(&radio);
+uint8_t uplinkPacket[RADIOLIB_LINK_ADR_HEADER_LEN + RADIOLIB_LINK_AGGREGATION_MAX_PACKET_LEN];
+
+// Function called by the aggregator with a complete packet, queues it behind the link header
+int16_t queueUplinkPacket(const uint8_t *data, size_t len)
+{
+  bool request = (adrRequestCount + 1 >= ADR_FEEDBACK_INTERVAL);
+  uplinkPacket[0] = adr.getHeader(request);
+  memcpy(&uplinkPacket[RADIOLIB_LINK_ADR_HEADER_LEN], data, len);
+
+  // Does not block, the packet is dropped if the uplink queue is full
+  int16_t state = uplink.send(uplinkPacket, RADIOLIB_LINK_ADR_HEADER_LEN + len, 0, UPLINK_DEADLINE_MS);
+  if (state == RADIOLIB_ERR_NONE) {
+    adrRequestCount = request ? 0 : adrRequestCount + 1;
+  }
+  return state;
+}
+
+// Airtime of a full uplink packet at the current data rate in ms, recalculated when the rate changes
+uint8_t uplinkRateIndex = 0xFF;
+uint32_t uplinkPacketAirtime = 0;
+
+// Function to calculate the minimum time in ms between uplink records of len bytes, so that a record type
+// using 1/share of the airtime budget never sends more than the link can carry. Faster records would only
+// fill the queue with packets that go stale while the newest ones are dropped
+unsigned long uplinkInterval(size_t len, uint8_t share)
+{
+  if (adr.getIndex() != uplinkRateIndex) {
+    uplinkRateIndex = adr.getIndex();
+    uplinkPacketAirtime = radio.getTimeOnAir(RADIOLIB_SX127X_MAX_PACKET_LENGTH) / 1000;
+  }
+
+  // Records are packed into full packets behind the link header and the aggregation type byte
+  uint64_t recordAirtime = (uint64_t)uplinkPacketAirtime * (len + RADIOLIB_LINK_AGGREGATION_RECORD_HEADER_LEN) /
+                           (RADIOLIB_SX127X_MAX_PACKET_LENGTH - RADIOLIB_LINK_ADR_HEADER_LEN - 1);
+  return recordAirtime * share * UPLINK_DUTY_CYCLE_WINDOW_MS / UPLINK_DUTY_CYCLE_LIMIT_MS;
+}
+
+// Telemetry frame buffer and sequence counter
+uint8_t frame[TELEMETRY_MAX_FRAME];
+uint16_t frameSeq = 0;
+
+// Function to encode a payload into a telemetry frame and send it, optionally also over the LoRa uplink
+void sendFrame(uint8_t sensorId, unsigned long timestamp, const uint8_t *payload, uint8_t payloadLen, bool radioUplink = false)
+{
+  size_t frameLen = telemetryEncode(frame, sensorId, frameSeq++, timestamp, payload, payloadLen);
+  Serial.write(frame, frameLen);
+
+  if (radioUplink) {
+    aggregator.add(frame, frameLen);
+  }
+}
+
+// Function to send a status frame, used instead of text messages so the stream stays binary
+void sendStatus(uint8_t code, int32_t value = 0)
+{
+  uint8_t payload[5];
+  uint8_t *pos = payload;
+  pos = telemetryPut8(pos, code);
+  pos = telemetryPut32(pos, value);
+  sendFrame(TELEMETRY_ID_STATUS, millis(), payload, pos - payload);
 }
 
-// Function to read and print BMI270 data (accelerometer and gyroscope)
-void checkAndPrintBMI270Data()
+// Time of the last GNSS record sent over the uplink
+unsigned long gnssUplinkLast = 0;
+
+// Function to read and send GNSS data, every solution goes to serial but only as many as the uplink can carry go over LoRa
+bool checkAndPrintGNSSData()
 {
-  float xAccel, yAccel, zAccel;
-  float xGyro, yGyro, zGyro;
+  myGNSS.checkUblox();  // Poll the GNSS
+
+  // With auto PVT this only returns true when a new solution has arrived, and never blocks
+  if (!myGNSS.getPVT()) {
+    return true;
+  }
+
+  uint8_t payload[9];
+  uint8_t *pos = payload;
+  pos = telemetryPut32(pos, myGNSS.getLatitude());
+  pos = telemetryPut32(pos, myGNSS.getLongitude());
+  pos = telemetryPut8(pos, myGNSS.getSIV());
+
   unsigned long timestamp = millis();
+  bool radioUplink = (timestamp - gnssUplinkLast >= uplinkInterval(TELEMETRY_HEADER_LEN + (pos - payload) + TELEMETRY_CRC_LEN, UPLINK_GNSS_SHARE));
+  if (radioUplink) {
+    gnssUplinkLast = timestamp;
+  }
+  sendFrame(TELEMETRY_ID_GNSS, timestamp, payload, pos - payload, radioUplink);
+  return true;
+}
+
+// Function to drain the LPS22HB FIFO and send the batch
+bool checkAndPrintLPS22HBData()
+{
+  LPS22HBSample samples[BARO_FIFO_DEPTH];
+  int count = BARO.readFifo(samples, BARO_FIFO_DEPTH);
 
-  if (IMU.accelerationAvailable() && IMU.gyroscopeAvailable())
+  // The newest sample was converted just now, older ones are one output period apart
+  unsigned long timestamp = millis();
+  for (int i = 0; i < count; i++)
   {
-    IMU.readAcceleration(xAccel, yAccel, zAccel);
-    IMU.readGyroscope(xGyro, yGyro, zGyro);
+    float altitude = BARO.computeAltitude(samples[i].pressure);
+    unsigned long sampleTime = timestamp - ((count - 1 - i) * 1000UL) / BARO_RATE_HZ;
+
+    uint8_t payload[10];
+    uint8_t *pos = payload;
+    pos = telemetryPut32(pos, telemetryFixed32(samples[i].pressure, TELEMETRY_SCALE_PRESSURE));
+    pos = telemetryPut16(pos, telemetryFixed16(samples[i].temperature, TELEMETRY_SCALE_TEMPERATURE));
+    pos = telemetryPut32(pos, telemetryFixed32(altitude, TELEMETRY_SCALE_ALTITUDE));
+    sendFrame(TELEMETRY_ID_LPS22HB, sampleTime, payload, pos - payload);
+  }
+  return true;
+}
 
-    // Convert g to m/s²
-    xAccel *= GRAVITY;
-    yAccel *= GRAVITY;
-    zAccel *= GRAVITY;
+// Function to drain the BMI270 FIFO and send the batch (accelerometer and gyroscope)
+bool checkAndPrintBMI270Data()
+{
+  IMUFifo.drainFifo();
 
-    snprintf(buffer, BUFF_SIZE, "BMI270,%.5f,%.5f,%.5f,%.5f,%.5f,%.5f,%lu", xAccel, yAccel, zAccel, xGyro, yGyro, zGyro, timestamp);
-    Serial.println(buffer);
+  IMUSample sample;
+  while (IMUFifo.readSample(sample))
+  {
+    // Acceleration is sent in mg, the decoder converts it to m/s²
+    uint8_t payload[12];
+    uint8_t *pos = payload;
+    for (int i = 0; i < 3; i++) {
+      pos = telemetryPut16(pos, telemetryFixed16(sample.accel[i] / IMU_FIFO_COUNTS_PER_G, TELEMETRY_SCALE_ACCEL));
+    }
+    for (int i = 0; i < 3; i++) {
+      pos = telemetryPut16(pos, telemetryFixed16(sample.gyro[i] / IMU_FIFO_COUNTS_PER_DPS, TELEMETRY_SCALE_GYRO));
+    }
+    sendFrame(TELEMETRY_ID_BMI270, sample.timestamp / 1000, payload, pos - payload);
   }
+  return true;
 }
 
-// Function to read and print magnetometer data from IMU
-void checkAndPrintIMUMagnetometer()
+// Function to read and send magnetometer data from IMU
+bool checkAndPrintIMUMagnetometer()
 {
   float x, y, z;
   unsigned long timestamp = millis();
-  if (IMU.magneticFieldAvailable())
+  if (IMUFifo.magneticFieldAvailable())
   {
-    IMU.readMagneticField(x, y, z);
-    snprintf(buffer, BUFF_SIZE, "BMM150,%.5f,%.5f,%.5f,%lu", x, y, z, timestamp);
-    Serial.println(buffer);
+    IMUFifo.readMagneticField(x, y, z);
+
+    uint8_t payload[6];
+    uint8_t *pos = payload;
+    pos = telemetryPut16(pos, telemetryFixed16(x, TELEMETRY_SCALE_MAG));
+    pos = telemetryPut16(pos, telemetryFixed16(y, TELEMETRY_SCALE_MAG));
+    pos = telemetryPut16(pos, telemetryFixed16(z, TELEMETRY_SCALE_MAG));
+    sendFrame(TELEMETRY_ID_BMM150, timestamp, payload, pos - payload);
   }
+  return true;
 }
 
-// Function to read and print temperature and humidity data from HS300x sensor
-void checkAndPrintHS300xData()
+// Function to send the scheduler statistics of every task and of the uplink, and start a new window
+bool printTaskStats()
 {
-  float temperature = HS300x.readTemperature();
-  float humidity = HS300x.readHumidity();
   unsigned long timestamp = millis();
-  snprintf(buffer, BUFF_SIZE, "HS300x,%.5f,%.5f,%lu", temperature, humidity, timestamp);
-  Serial.println(buffer);
+  for (int i = 0; i < scheduler.taskCount(); i++)
+  {
+    const Task& task = scheduler.task(i);
+    uint8_t payload[21];
+    uint8_t *pos = payload;
+    pos = telemetryPut8(pos, i);
+    pos = telemetryPut32(pos, task.runs);
+    pos = telemetryPut32(pos, task.overruns);
+    pos = telemetryPut32(pos, task.skipped);
+    pos = telemetryPut32(pos, task.maxJitter);
+    pos = telemetryPut32(pos, task.maxExec);
+    sendFrame(TELEMETRY_ID_TASK_STATS, timestamp, payload, pos - payload);
+  }
+  scheduler.resetStats();
+
+  uint8_t payload[13];
+  uint8_t *pos = payload;
+  pos = telemetryPut32(pos, uplinkSent);
+  pos = telemetryPut32(pos, uplinkFailed);
+  pos = telemetryPut32(pos, uplink.getDropped());
+  pos = telemetryPut8(pos, adr.getIndex());
+  sendFrame(TELEMETRY_ID_UPLINK, timestamp, payload, pos - payload);
+  return true;
+}
+
+// HS300x conversion in progress, started at hs300xStart (ms), and time of the last HS300x record sent over the uplink
+bool hs300xConverting = false;
+unsigned long hs300xStart = 0;
+unsigned long hs300xUplinkLast = 0;
+
+// Function to read and send temperature and humidity data from HS300x sensor
+// The first step requests a conversion, later steps fetch it once it is done, so the ~35 ms
+// conversion never blocks the scheduler
+bool checkAndPrintHS300xData()
+{
+  if (!hs300xConverting) {
+    if (!HS300xAsync.startConversion()) {
+      return true;
+    }
+    hs300xConverting = true;
+    hs300xStart = millis();
+    return false;
+  }
+
+  if (millis() - hs300xStart < HS300X_ASYNC_CONVERSION_MS) {
+    return false;
+  }
+
+  float temperature, humidity;
+  int state = HS300xAsync.readConversion(temperature, humidity);
+  if (state == 0) {
+    return false;
+  }
+  hs300xConverting = false;
+  if (state < 0) {
+    return true;
+  }
+
+  uint8_t payload[4];
+  uint8_t *pos = payload;
+  pos = telemetryPut16(pos, telemetryFixed16(temperature, TELEMETRY_SCALE_TEMPERATURE));
+  pos = telemetryPut16(pos, telemetryFixed16(humidity, TELEMETRY_SCALE_HUMIDITY));
+
+  bool radioUplink = (hs300xStart - hs300xUplinkLast >= uplinkInterval(TELEMETRY_HEADER_LEN + (pos - payload) + TELEMETRY_CRC_LEN, UPLINK_HS300X_SHARE));
+  if (radioUplink) {
+    hs300xUplinkLast = hs300xStart;
+  }
+  sendFrame(TELEMETRY_ID_HS300X, hs300xStart, payload, pos - payload, radioUplink);
+  return true;
 }
 
 // Initial setup function
@@ -90,7 +371,7 @@ void setup()
   // Initialize GNSS
   Wire.begin();
   if (myGNSS.begin() == false) {
-    Serial.println("u-blox GNSS not detected at default I2C address. Freezing.");
+    sendStatus(TELEMETRY_STATUS_GNSS_FAILED);
     while (1);
   }
 
@@ -100,44 +381,73 @@ void setup()
 
   // Initialize Barometric Pressure and Temperature Sensor (LPS22HB)
   if (!BARO.begin()) {
-    Serial.println("Failed to init LPS22HB!");
+    sendStatus(TELEMETRY_STATUS_LPS22HB_FAILED);
     while (1);
   }
   BARO.setOutputRate(RATE_75_HZ); // Set the output rate to 75 Hz
+  BARO.setFifoMode(FIFO_MODE_STREAM); // Buffer samples in the FIFO, read in batches
 
-  // Initialize IMU for Accelerometer, Gyroscope, and Magnetometer
-  if (!IMU.begin()) {
-    Serial.println("Failed to init IMU!");
+  // Initialize IMU for Accelerometer, Gyroscope, and Magnetometer, with accel/gyro batched in the FIFO
+  if (!IMUFifo.begin()) {
+    sendStatus(TELEMETRY_STATUS_IMU_FAILED);
     while (1);
   }
   else {
-    snprintf(buffer, BUFF_SIZE, "Gyro sample rate = %.2f Hz", IMU.gyroscopeSampleRate());
-    Serial.println(buffer);
-
-    snprintf(buffer, BUFF_SIZE, "Accelerometer sample rate = %.2f Hz", IMU.accelerationSampleRate());
-    Serial.println(buffer);
-
-    snprintf(buffer, BUFF_SIZE, "Magnetometer sample rate = %.2f Hz", IMU.magneticFieldSampleRate());
-    Serial.println(buffer);
+    sendStatus(TELEMETRY_STATUS_GYRO_RATE, telemetryFixed32(IMUFifo.gyroscopeSampleRate(), TELEMETRY_SCALE_RATE));
+    sendStatus(TELEMETRY_STATUS_ACCEL_RATE, telemetryFixed32(IMUFifo.accelerationSampleRate(), TELEMETRY_SCALE_RATE));
+    sendStatus(TELEMETRY_STATUS_MAG_RATE, telemetryFixed32(IMUFifo.magneticFieldSampleRate(), TELEMETRY_SCALE_RATE));
 
+    IMUFifo.startFifo();
   }
   
 
   // Initialize Humidity and Temperature Sensor (HS300x)
-  if (!HS300x.begin()) {
-    Serial.println("Failed to init HS300x!");
+  if (!HS300xAsync.begin()) {
+    sendStatus(TELEMETRY_STATUS_HS300X_FAILED);
     while (1);
   }
 
-  Serial.println("All sensors init success");
+  sendStatus(TELEMETRY_STATUS_READY);
+
+  // Initialize RFM95 with the same settings as the ground station
+  int state = radio.begin(915.0, 62.5, 12, 8, RADIOLIB_SX127X_SYNC_WORD, 20, 8, 0);
+  if (state != RADIOLIB_ERR_NONE) {
+    sendStatus(TELEMETRY_STATUS_RADIO_FAILED, state);
+    while (1);
+  }
+  radio.setPacketSentAction(onDio0);
+  uplink.setPacketSentCallback(onUplinkDone);
+  uplinkBudget.begin(UPLINK_DUTY_CYCLE_WINDOW_MS, UPLINK_DUTY_CYCLE_LIMIT_MS);
+  uplink.setAirtimeBudget(&uplinkBudget);
+  aggregator.begin(RADIOLIB_SX127X_MAX_PACKET_LENGTH - RADIOLIB_LINK_ADR_HEADER_LEN);
+  aggregator.setSendCallback(queueUplinkPacket);
+
+  // Start at the most robust rate, same as the ground station
+  state = adr.begin();
+  if (state != RADIOLIB_ERR_NONE) {
+    sendStatus(TELEMETRY_STATUS_ADR_FAILED, state);
+    while (1);
+  }
+
+  // Register each sensor at its natural rate, periods and deadlines in microseconds
+  scheduler.addTask("BMI270", checkAndPrintBMI270Data, 10000, 5000);
+  scheduler.addTask("LPS22HB", checkAndPrintLPS22HBData, 200000);
+  scheduler.addTask("GNSS", checkAndPrintGNSSData, 25000);
+  scheduler.addTask("BMM150", checkAndPrintIMUMagnetometer, 50000);
+  scheduler.addTask("HS300x", checkAndPrintHS300xData, 1000000);
+  scheduler.addTask("Stats", printTaskStats, 5000000);
 }
 
 // Main program loop
 void loop()
 {
-  checkAndPrintBMI270Data(); 
-  checkAndPrintIMUMagnetometer();
-  checkAndPrintGNSSData();
-  checkAndPrintLPS22HBData();
-  checkAndPrintHS300xData();
+  // Chain the next uplink packet as soon as the previous one is done, sensing continues meanwhile
+  // A partially filled packet is only flushed when the uplink has nothing else to send,
+  // while packets wait for airtime the records keep filling it instead
+  if (uplink.available() == 0) {
+    aggregator.process();
+  }
+  uplink.process();
+  serviceAdr();
+  scheduler.run();
 }